@@ -0,0 +1,139 @@
+// batch_extractor.cpp
+// non-interactive pattern matching over all records
+// writes every candidate (record ID, pattern, construction IDs, byte offsets, trigger) to a csv file
+// with --profile, also reports time, scanned bytes, hits, and annotator decisions per pattern
+
+#include "constructicon-simple.h"
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace CC = CausalConstructicon;
+
+int main(int argc, char* argv[]) {
+    // usage: ./batch_extractor [--profile[=report.json]] [output file] [number of threads]
+    std::string profileFile;
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--profile") {
+            profileFile = "pattern_profile.json";
+        } else if (arg.rfind("--profile=", 0) == 0) {
+            profileFile = arg.substr(10);
+        } else {
+            args.push_back(arg);
+        }
+    }
+    std::string outputFile = args.size() > 0 ? args[0] : "candidates.csv";
+    size_t threadCount = args.size() > 1 ? static_cast<size_t>(std::atoi(args[1].c_str())) : std::thread::hardware_concurrency();
+    if (threadCount == 0) threadCount = 1;
+
+    const auto& records = Annotator::records;
+    const auto& patterns = CC::getPatterns();
+
+    // counters per pattern, only filled when profiling
+    CC::PatternProfile profile(patterns.size());
+    CC::PatternProfile* profiling = profileFile.empty() ? nullptr : &profile;
+
+    // compile once before the workers share it; matching itself does not modify the matcher
+    const CC::PatternMatcher& matcher = CC::getMatcher();
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    // thread pool: each worker takes the next block of records until none are left
+    // results are stored by record index, so the output order does not depend on scheduling
+    const size_t blockSize = 16;
+    std::vector<std::vector<CC::PatternMatch>> results(records.size());
+    std::atomic<size_t> nextRecord(0);
+
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threadCount; t++) {
+        workers.emplace_back([&]() {
+            while (true) {
+                size_t begin = nextRecord.fetch_add(blockSize);
+                if (begin >= records.size()) return;
+                size_t end = std::min(begin + blockSize, records.size());
+                for (size_t i = begin; i < end; i++) {
+                    CC::SegmentView segments = Annotator::segmentIndex[i];
+                    results[i] = matcher.match(records[i].probableCause, profiling, &segments);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    auto matchTime = std::chrono::steady_clock::now();
+
+    // write candidates in record order, then by start offset
+    std::ofstream file(outputFile);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open " << outputFile << " for writing" << std::endl;
+        return EXIT_FAILURE;
+    }
+    file << "record_id,pattern,construction_ids,start,end,trigger\n";
+
+    size_t candidateCount = 0;
+    std::vector<size_t> patternCounts(patterns.size(), 0);
+
+    for (size_t i = 0; i < records.size(); i++) {
+        const auto& text = records[i].probableCause;
+        for (const auto& hit : results[i]) {
+            const auto& pattern = patterns[hit.patternIndex];
+            std::string ids;
+            for (const auto& id : pattern.ids) {
+                ids += (ids.empty() ? "" : ";") + id.str();
+            }
+            file << records[i].recordID << ","
+                << Annotator::csvField(pattern.description) << ","
+                << ids << ","
+                << hit.start << ","
+                << hit.end << ","
+                << Annotator::csvField(text.substr(hit.start, hit.end - hit.start)) << "\n";
+            candidateCount++;
+            patternCounts[hit.patternIndex]++;
+        }
+    }
+    file.close();
+
+    double seconds = std::chrono::duration<double>(matchTime - startTime).count();
+
+    std::cout << "\n*** Batch Extraction ***" << std::endl;
+    std::cout << "Records: " << records.size() << std::endl;
+    std::cout << "Threads: " << threadCount << std::endl;
+    std::cout << "Candidates: " << candidateCount << std::endl;
+    std::cout << "Matching time: " << seconds << " s" << std::endl;
+    std::cout << "Candidates written to " << outputFile << std::endl;
+
+    std::cout << "\nCandidates per pattern:" << std::endl;
+    for (size_t p = 0; p < patterns.size(); p++) {
+        if (patternCounts[p] > 0) {
+            std::cout << patternCounts[p] << "\t" << patterns[p].description << std::endl;
+        }
+    }
+
+    if (profiling) {
+        // annotator decisions so far, from decisions.bin
+        for (size_t p = 0; p < patterns.size() && p < Annotator::patternDecisions.size(); p++) {
+            profile.addDecisions(p, Annotator::patternDecisions[p].verified, Annotator::patternDecisions[p].rejected);
+        }
+
+        std::cout << "\nPattern profile (patterns scanned one at a time, most expensive first):" << std::endl;
+        profile.writeTable(std::cout, patterns);
+
+        std::ofstream report(profileFile);
+        if (!report.is_open()) {
+            std::cerr << "Failed to open " << profileFile << " for writing" << std::endl;
+            return EXIT_FAILURE;
+        }
+        report << profile.toJSON(patterns).dump(2) << "\n";
+        std::cout << "Pattern profile written to " << profileFile << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -1,65 +1,1783 @@
 #include "constructicon-simple.h"
 #include "constructions.h"
 #include "patterns.h"
+#include "lexicon.h"
+#include "pattern_tables.h"
 #include <iostream>
 #include <fstream>
+#include <cstdio>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstring>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <charconv>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 namespace CausalConstructicon {
 
     // storage
+    // the builtin constructions live in the constexpr table in constructions.h and are
+    // copied into the vector on first access, at the same indices as in the table
     std::vector<CausalConstruction> constructions;
     std::vector<CausalPattern> patterns;
+    static bool builtinConstructionsLoaded = false;
+
+    // compiled matcher, rebuilt lazily whenever the pattern set changed
+    static PatternMatcher matcher;
+    static bool matcherStale = true;
+
+    // construction ID registry
+    // handle values index ids; builtin IDs are resolved with the compile-time perfect hash,
+    // all other IDs through the hash table; a deque keeps returned strings valid while it grows
+    struct ConstructionRegistry {
+        std::deque<std::string> ids;
+        std::unordered_map<std::string, uint32_t> index;
+        // index of each handle's construction in constructions, or -1 if there is none
+        std::vector<long> constructionIndex;
+        std::mutex mutex;
+
+        ConstructionRegistry() {
+            for (const auto& c : InitialConstructions::constructions) {
+                ids.emplace_back(c.id);
+                constructionIndex.push_back(static_cast<long>(constructionIndex.size()));
+            }
+        }
+
+        // caller holds the mutex
+        uint32_t find(const std::string& id) const {
+            int builtin = InitialConstructions::idIndex.find(id);
+            if (builtin >= 0) return static_cast<uint32_t>(builtin);
+            auto found = index.find(id);
+            return found == index.end() ? ConstructionHandle::Invalid : found->second;
+        }
+    };
+
+    // function-local static, because patterns intern their IDs during static initialization
+    static ConstructionRegistry& registry() {
+        static ConstructionRegistry instance;
+        return instance;
+    }
+
+    static uint32_t internConstructionID(const std::string& id) {
+        if (id.empty()) return ConstructionHandle::Invalid;
+        auto& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        uint32_t value = r.find(id);
+        if (value == ConstructionHandle::Invalid) {
+            value = static_cast<uint32_t>(r.ids.size());
+            r.ids.push_back(id);
+            r.index.emplace(id, value);
+            r.constructionIndex.push_back(-1);
+        }
+        return value;
+    }
+
+    ConstructionHandle::ConstructionHandle(const char* id) : value(internConstructionID(id)) {}
+
+    ConstructionHandle::ConstructionHandle(const std::string& id) : value(internConstructionID(id)) {}
+
+    const std::string& ConstructionHandle::str() const {
+        static const std::string none;
+        if (!valid()) return none;
+        auto& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        return value < r.ids.size() ? r.ids[value] : none;
+    }
+
+    std::ostream& operator<<(std::ostream& out, const ConstructionHandle& handle) {
+        return out << handle.str();
+    }
+
+    ConstructionHandle lookupConstructionID(const std::string& id) {
+        auto& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        ConstructionHandle handle;
+        handle.value = r.find(id);
+        return handle;
+    }
+
+    size_t constructionHandleCount() {
+        auto& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        return r.ids.size();
+    }
 
     // constructions
     std::vector<CausalConstruction>& getConstructions() {
+        if (!builtinConstructionsLoaded) {
+            builtinConstructionsLoaded = true;
+            std::vector<CausalConstruction> added;
+            added.swap(constructions);
+            constructions.reserve(InitialConstructions::count + added.size());
+            for (const auto& c : InitialConstructions::constructions) {
+                constructions.emplace_back(std::string(c.id), c.degree, c.order, std::string(c.trigger_template), std::string(c.example));
+            }
+            constructions.insert(constructions.end(), added.begin(), added.end());
+        }
         return constructions;
     }
 
-    void addConstruction(const CausalConstruction& construction) {
-        if (findConstructionByID(construction.id) == nullptr) {
-            constructions.push_back(construction);
-        } else {
-            std::cerr << "Warning: Construction with ID " << construction.id << " already exists. Skipping." << std::endl;
+    void addConstruction(const CausalConstruction& construction) {
+        if (findConstructionByID(construction.id) == nullptr) {
+            auto& all = getConstructions();
+            ConstructionHandle handle(construction.id);
+            all.push_back(construction);
+
+            auto& r = registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            r.constructionIndex[handle.value] = static_cast<long>(all.size() - 1);
+        } else {
+            std::cerr << "Warning: Construction with ID " << construction.id << " already exists. Skipping." << std::endl;
+        }
+    }
+
+    const CausalConstruction* findConstructionByID(const std::string& id) {
+        return findConstruction(lookupConstructionID(id));
+    }
+
+    const CausalConstruction* findConstruction(ConstructionHandle handle) {
+        if (!handle.valid()) return nullptr;
+        auto& all = getConstructions();
+        auto& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        if (handle.value >= r.constructionIndex.size() || r.constructionIndex[handle.value] < 0) return nullptr;
+        return &all[static_cast<size_t>(r.constructionIndex[handle.value])];
+    }
+
+    // patterns
+    // index of pattern descriptions for the duplicate check
+    static std::unordered_map<std::string, size_t> patternDescriptions;
+
+    void addPattern(const CausalPattern& newPattern) {
+        if (patternDescriptions.count(newPattern.description) > 0) {
+            std::cerr << "Warning: Pattern '" << newPattern.description << "' already exists. Skipping." << std::endl;
+            return;
+        }
+        patternDescriptions.emplace(newPattern.description, patterns.size());
+        patterns.push_back(newPattern);
+        matcherStale = true;
+    }
+
+    std::vector<CausalPattern>& getPatterns() {
+        return patterns;
+    }
+
+    // pattern matcher
+
+    // parse tree of a pattern source in the supported regex subset
+    struct RegexNode {
+        enum class Kind { Empty, Literal, Space, Any, WordBoundary, NotWordBoundary, Concat, Alternate, Star, Plus, Quest };
+        Kind kind;
+        unsigned char c;
+        bool lazy;
+        std::vector<RegexNode> children;
+
+        RegexNode(Kind k = Kind::Empty, unsigned char ch = 0) : kind(k), c(ch), lazy(false) {}
+    };
+
+    // helper: ASCII lowercase, since all patterns are case-insensitive
+    static unsigned char toLowerByte(unsigned char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c - 'A' + 'a') : c;
+    }
+
+    // helper: word characters as defined by \b in ECMAScript regexes
+    static bool isWordByte(unsigned char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    }
+
+    // helper: whitespace as defined by \s
+    static bool isSpaceByte(unsigned char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+    }
+
+    // recursive descent parser for the regex subset, plus code generation into the shared program
+    // parse functions return false if the source uses anything outside of the subset
+    struct PatternCompiler {
+        const std::string& source;
+        size_t pos;
+
+        explicit PatternCompiler(const std::string& s) : source(s), pos(0) {}
+
+        bool parse(RegexNode& node) {
+            return parseAlternate(node) && pos == source.size();
+        }
+
+        bool parseAlternate(RegexNode& node) {
+            RegexNode first;
+            if (!parseConcat(first)) return false;
+            if (pos >= source.size() || source[pos] != '|') {
+                node = first;
+                return true;
+            }
+            node = RegexNode(RegexNode::Kind::Alternate);
+            node.children.push_back(first);
+            while (pos < source.size() && source[pos] == '|') {
+                pos++;
+                RegexNode next;
+                if (!parseConcat(next)) return false;
+                node.children.push_back(next);
+            }
+            return true;
+        }
+
+        bool parseConcat(RegexNode& node) {
+            node = RegexNode(RegexNode::Kind::Concat);
+            while (pos < source.size() && source[pos] != '|' && source[pos] != ')') {
+                RegexNode item;
+                if (!parseRepeat(item)) return false;
+                node.children.push_back(item);
+            }
+            return true;
+        }
+
+        bool parseRepeat(RegexNode& node) {
+            RegexNode atom;
+            if (!parseAtom(atom)) return false;
+            if (pos < source.size() && (source[pos] == '*' || source[pos] == '+' || source[pos] == '?')) {
+                char q = source[pos++];
+                node = RegexNode(q == '*' ? RegexNode::Kind::Star : q == '+' ? RegexNode::Kind::Plus : RegexNode::Kind::Quest);
+                node.children.push_back(atom);
+                if (pos < source.size() && source[pos] == '?') {
+                    node.lazy = true;
+                    pos++;
+                }
+                // stacked quantifiers like a** are not part of the subset
+                if (pos < source.size() && (source[pos] == '*' || source[pos] == '+' || source[pos] == '?')) return false;
+            } else {
+                node = atom;
+            }
+            return true;
+        }
+
+        bool parseAtom(RegexNode& node) {
+            unsigned char c = source[pos++];
+            switch (c) {
+                case '(':
+                    // non-capturing groups behave the same, since the matcher has no captures
+                    if (source.compare(pos, 2, "?:") == 0) pos += 2;
+                    else if (pos < source.size() && source[pos] == '?') return false;
+                    if (!parseAlternate(node)) return false;
+                    if (pos >= source.size() || source[pos] != ')') return false;
+                    pos++;
+                    return true;
+                case '.':
+                    node = RegexNode(RegexNode::Kind::Any);
+                    return true;
+                case '\\': {
+                    if (pos >= source.size()) return false;
+                    unsigned char e = source[pos++];
+                    if (e == 'b') node = RegexNode(RegexNode::Kind::WordBoundary);
+                    else if (e == 'B') node = RegexNode(RegexNode::Kind::NotWordBoundary);
+                    else if (e == 's') node = RegexNode(RegexNode::Kind::Space);
+                    else if (isWordByte(e)) return false; // classes like \d or \w, and back references
+                    else node = RegexNode(RegexNode::Kind::Literal, e);
+                    return true;
+                }
+                case '[': case ']': case '{': case '}': case '^': case '$': case '*': case '+': case '?': case ')': case '|':
+                    return false;
+                default:
+                    node = RegexNode(RegexNode::Kind::Literal, toLowerByte(c));
+                    return true;
+            }
+        }
+
+        // Thompson construction; split instructions try x before y, which gives leftmost-first priorities
+        static void emit(std::vector<PatternMatcher::Instruction>& program, const RegexNode& node) {
+            using Op = PatternMatcher::Op;
+            auto at = [&program]() { return static_cast<unsigned int>(program.size()); };
+            switch (node.kind) {
+                case RegexNode::Kind::Empty:
+                    break;
+                case RegexNode::Kind::Literal:
+                    program.push_back({Op::Char, node.c, 0, 0});
+                    break;
+                case RegexNode::Kind::Space:
+                    program.push_back({Op::Space, 0, 0, 0});
+                    break;
+                case RegexNode::Kind::Any:
+                    program.push_back({Op::Any, 0, 0, 0});
+                    break;
+                case RegexNode::Kind::WordBoundary:
+                    program.push_back({Op::WordBoundary, 0, 0, 0});
+                    break;
+                case RegexNode::Kind::NotWordBoundary:
+                    program.push_back({Op::NotWordBoundary, 0, 0, 0});
+                    break;
+                case RegexNode::Kind::Concat:
+                    for (const auto& child : node.children) emit(program, child);
+                    break;
+                case RegexNode::Kind::Alternate: {
+                    std::vector<unsigned int> jumps;
+                    for (size_t i = 0; i < node.children.size(); i++) {
+                        unsigned int split = at();
+                        bool last = (i + 1 == node.children.size());
+                        if (!last) program.push_back({Op::Split, 0, split + 1, 0});
+                        emit(program, node.children[i]);
+                        if (!last) {
+                            jumps.push_back(at());
+                            program.push_back({Op::Jump, 0, 0, 0});
+                            program[split].y = at();
+                        }
+                    }
+                    for (unsigned int j : jumps) program[j].x = at();
+                    break;
+                }
+                case RegexNode::Kind::Star: {
+                    unsigned int split = at();
+                    program.push_back({Op::Split, 0, 0, 0});
+                    emit(program, node.children[0]);
+                    program.push_back({Op::Jump, 0, split, 0});
+                    program[split].x = node.lazy ? at() : split + 1;
+                    program[split].y = node.lazy ? split + 1 : at();
+                    break;
+                }
+                case RegexNode::Kind::Plus: {
+                    unsigned int body = at();
+                    emit(program, node.children[0]);
+                    unsigned int split = at();
+                    program.push_back({Op::Split, 0, 0, 0});
+                    program[split].x = node.lazy ? at() : body;
+                    program[split].y = node.lazy ? body : at();
+                    break;
+                }
+                case RegexNode::Kind::Quest: {
+                    unsigned int split = at();
+                    program.push_back({Op::Split, 0, 0, 0});
+                    emit(program, node.children[0]);
+                    program[split].x = node.lazy ? at() : split + 1;
+                    program[split].y = node.lazy ? split + 1 : at();
+                    break;
+                }
+            }
+        }
+
+        // literals that every match of a node contains (at least one of the set)
+        // exact means the node only ever matches one of the strings, so neighbouring literals can be joined
+        struct LiteralInfo {
+            bool exact;
+            std::vector<std::string> strings;
+            std::vector<std::string> required;
+        };
+
+        // sets of joined literals grow as cross products; bigger sets are cut at the next node
+        static const size_t MaxLiteralSet = 16;
+
+        static size_t shortest(const std::vector<std::string>& set) {
+            size_t length = std::string::npos;
+            for (const auto& literal : set) length = std::min(length, literal.size());
+            return set.empty() ? 0 : length;
+        }
+
+        // keep the candidate with the longest shortest literal, since long literals rule out more records
+        static void preferLiterals(std::vector<std::string>& best, const std::vector<std::string>& candidate) {
+            if (shortest(candidate) == 0) return;
+            if (shortest(candidate) > shortest(best) || (shortest(candidate) == shortest(best) && candidate.size() < best.size())) {
+                best = candidate;
+            }
+        }
+
+        static void unique(std::vector<std::string>& set) {
+            std::sort(set.begin(), set.end());
+            set.erase(std::unique(set.begin(), set.end()), set.end());
+        }
+
+        static LiteralInfo analyze(const RegexNode& node) {
+            LiteralInfo info{false, {}, {}};
+            switch (node.kind) {
+                case RegexNode::Kind::Empty:
+                case RegexNode::Kind::WordBoundary:
+                case RegexNode::Kind::NotWordBoundary:
+                    info.exact = true;
+                    info.strings.push_back("");
+                    break;
+                case RegexNode::Kind::Literal:
+                    info.exact = true;
+                    info.strings.push_back(std::string(1, static_cast<char>(node.c)));
+                    break;
+                case RegexNode::Kind::Space:
+                case RegexNode::Kind::Any:
+                case RegexNode::Kind::Star:
+                    break;
+                case RegexNode::Kind::Concat: {
+                    std::vector<std::string> run(1, "");
+                    bool allExact = true;
+                    for (const auto& child : node.children) {
+                        LiteralInfo part = analyze(child);
+                        if (part.exact && run.size() * part.strings.size() <= MaxLiteralSet) {
+                            std::vector<std::string> joined;
+                            for (const auto& left : run) {
+                                for (const auto& right : part.strings) joined.push_back(left + right);
+                            }
+                            run = joined;
+                            unique(run);
+                            continue;
+                        }
+                        allExact = false;
+                        preferLiterals(info.required, run);
+                        preferLiterals(info.required, part.exact ? part.strings : part.required);
+                        run = part.exact ? part.strings : std::vector<std::string>(1, "");
+                    }
+                    if (allExact) {
+                        info.exact = true;
+                        info.strings = run;
+                    } else {
+                        preferLiterals(info.required, run);
+                    }
+                    break;
+                }
+                case RegexNode::Kind::Alternate: {
+                    bool allExact = true;
+                    bool allRequired = true;
+                    std::vector<std::string> strings;
+                    std::vector<std::string> required;
+                    for (const auto& child : node.children) {
+                        LiteralInfo part = analyze(child);
+                        allExact = allExact && part.exact;
+                        const auto& needed = part.exact ? part.strings : part.required;
+                        if (shortest(needed) == 0) allRequired = false;
+                        strings.insert(strings.end(), part.strings.begin(), part.strings.end());
+                        required.insert(required.end(), needed.begin(), needed.end());
+                    }
+                    unique(strings);
+                    unique(required);
+                    if (allExact && strings.size() <= MaxLiteralSet) {
+                        info.exact = true;
+                        info.strings = strings;
+                    } else if (allRequired) {
+                        info.required = required;
+                    }
+                    break;
+                }
+                case RegexNode::Kind::Quest: {
+                    LiteralInfo part = analyze(node.children[0]);
+                    if (part.exact && part.strings.size() < MaxLiteralSet) {
+                        info.exact = true;
+                        info.strings = part.strings;
+                        info.strings.push_back("");
+                        unique(info.strings);
+                    }
+                    break;
+                }
+                case RegexNode::Kind::Plus: {
+                    LiteralInfo part = analyze(node.children[0]);
+                    info.required = part.exact ? part.strings : part.required;
+                    if (shortest(info.required) == 0) info.required.clear();
+                    break;
+                }
+            }
+            return info;
+        }
+
+        // required literals of a whole pattern, or an empty set if there are none
+        // inflections like "contribute|contributes|contributed" share one search for their stem "contribut"
+        static std::vector<std::string> requiredLiterals(const RegexNode& node) {
+            LiteralInfo info = analyze(node);
+            std::vector<std::string> set = info.exact ? info.strings : info.required;
+            if (shortest(set) == 0) return {};
+
+            size_t prefix = shortest(set);
+            for (const auto& literal : set) {
+                size_t common = 0;
+                while (common < prefix && literal[common] == set[0][common]) common++;
+                prefix = common;
+            }
+            if (set.size() > 1 && prefix >= 3) set = {set[0].substr(0, prefix)};
+            return set;
+        }
+
+        // the word sequences a node matches, in leftmost-first order, if it only consists of literals, \s+,
+        // \b, alternatives, and optional parts; in the sequences, WordSpace stands for \s+ and WordEdge for \b
+        // false for anything else, or for more than MaxSequences sequences
+        static const char WordSpace = '\x01';
+        static const char WordEdge = '\x02';
+        static const size_t MaxSequences = 64;
+
+        static bool wordSequences(const RegexNode& node, std::vector<std::string>& result) {
+            result.clear();
+            switch (node.kind) {
+                case RegexNode::Kind::Empty:
+                    result.push_back("");
+                    return true;
+                case RegexNode::Kind::WordBoundary:
+                    result.push_back(std::string(1, WordEdge));
+                    return true;
+                case RegexNode::Kind::Literal:
+                    result.push_back(std::string(1, static_cast<char>(node.c)));
+                    return true;
+                case RegexNode::Kind::Plus:
+                    if (node.children[0].kind != RegexNode::Kind::Space) return false;
+                    result.push_back(std::string(1, WordSpace));
+                    return true;
+                case RegexNode::Kind::Concat: {
+                    result.push_back("");
+                    std::vector<std::string> part;
+                    for (const auto& child : node.children) {
+                        if (!wordSequences(child, part)) return false;
+                        std::vector<std::string> joined;
+                        for (const auto& left : result) {
+                            for (const auto& right : part) joined.push_back(left + right);
+                        }
+                        if (joined.size() > MaxSequences) return false;
+                        result = joined;
+                    }
+                    return true;
+                }
+                case RegexNode::Kind::Alternate: {
+                    std::vector<std::string> part;
+                    for (const auto& child : node.children) {
+                        if (!wordSequences(child, part)) return false;
+                        result.insert(result.end(), part.begin(), part.end());
+                    }
+                    return result.size() <= MaxSequences;
+                }
+                case RegexNode::Kind::Quest: {
+                    // greedy tries the optional part first, lazy tries it last
+                    std::vector<std::string> part;
+                    if (!wordSequences(node.children[0], part)) return false;
+                    if (node.lazy) result.push_back("");
+                    result.insert(result.end(), part.begin(), part.end());
+                    if (!node.lazy) result.push_back("");
+                    return result.size() <= MaxSequences;
+                }
+                default:
+                    // wildcards, other repetitions, single whitespace, and \B
+                    return false;
+            }
+        }
+
+        // the words of a word sequence: a \b, words of word bytes separated by one \s+ each, and a \b;
+        // a \b next to a \s+ always holds and is dropped; false if the sequence has any other form
+        static bool splitWords(const std::string& sequence, std::vector<std::string>& words) {
+            words.clear();
+            std::string normalized;
+            for (size_t i = 0; i < sequence.size(); i++) {
+                bool nextToSpace = (i > 0 && sequence[i - 1] == WordSpace) || (i + 1 < sequence.size() && sequence[i + 1] == WordSpace);
+                if (sequence[i] == WordEdge && nextToSpace) continue;
+                normalized += sequence[i];
+            }
+            if (normalized.size() < 3 || normalized.front() != WordEdge || normalized.back() != WordEdge) return false;
+
+            std::string word;
+            for (size_t i = 1; i + 1 < normalized.size(); i++) {
+                char c = normalized[i];
+                if (c == WordSpace) {
+                    if (word.empty()) return false;
+                    words.push_back(word);
+                    word.clear();
+                } else if (isWordByte(static_cast<unsigned char>(c))) {
+                    word += c;
+                } else {
+                    return false;
+                }
+            }
+            if (word.empty()) return false;
+            words.push_back(word);
+            return true;
+        }
+
+        // representative strings matched by a node, used to find out which patterns subsume others
+        // whitespace becomes one space and a wildcard becomes one word; repetitions are taken once
+        static const size_t MaxSamples = 16;
+
+        static std::vector<std::string> samples(const RegexNode& node) {
+            std::vector<std::string> result;
+            switch (node.kind) {
+                case RegexNode::Kind::Empty:
+                case RegexNode::Kind::WordBoundary:
+                case RegexNode::Kind::NotWordBoundary:
+                    result.push_back("");
+                    break;
+                case RegexNode::Kind::Literal:
+                    result.push_back(std::string(1, static_cast<char>(node.c)));
+                    break;
+                case RegexNode::Kind::Space:
+                    result.push_back(" ");
+                    break;
+                case RegexNode::Kind::Any:
+                    result.push_back("x");
+                    break;
+                case RegexNode::Kind::Concat: {
+                    result.push_back("");
+                    for (const auto& child : node.children) {
+                        std::vector<std::string> joined;
+                        for (const auto& left : result) {
+                            for (const auto& right : samples(child)) {
+                                if (joined.size() < MaxSamples) joined.push_back(left + right);
+                            }
+                        }
+                        result = joined;
+                    }
+                    break;
+                }
+                case RegexNode::Kind::Alternate:
+                    for (const auto& child : node.children) {
+                        for (const auto& sample : samples(child)) {
+                            if (result.size() < MaxSamples) result.push_back(sample);
+                        }
+                    }
+                    break;
+                case RegexNode::Kind::Quest:
+                    result.push_back("");
+                    // the optional part is sampled as present too
+                    [[fallthrough]];
+                case RegexNode::Kind::Star:
+                case RegexNode::Kind::Plus:
+                    for (const auto& sample : samples(node.children[0])) {
+                        if (result.size() < MaxSamples) result.push_back(sample);
+                    }
+                    break;
+            }
+            return result;
+        }
+
+        // bytes that can be consumed first from pc; assertions are treated as always true,
+        // which over-approximates the set but is safe for deciding where to start threads
+        static void collectFirstBytes(const std::vector<PatternMatcher::Instruction>& program, unsigned int pc,
+            std::vector<bool>& visited, std::bitset<256>& bytes) {
+            using Op = PatternMatcher::Op;
+            if (visited[pc]) return;
+            visited[pc] = true;
+            const auto& inst = program[pc];
+            switch (inst.op) {
+                case Op::Char:
+                    bytes.set(inst.c);
+                    break;
+                case Op::Space:
+                    for (unsigned int b = 0; b < 256; b++) if (isSpaceByte(static_cast<unsigned char>(b))) bytes.set(b);
+                    break;
+                case Op::Any:
+                case Op::Match:
+                    // a pattern that can match the empty string may start anywhere
+                    bytes.set();
+                    break;
+                case Op::Split:
+                    collectFirstBytes(program, inst.x, visited, bytes);
+                    collectFirstBytes(program, inst.y, visited, bytes);
+                    break;
+                case Op::Jump:
+                    collectFirstBytes(program, inst.x, visited, bytes);
+                    break;
+                case Op::WordBoundary:
+                case Op::NotWordBoundary:
+                    collectFirstBytes(program, pc + 1, visited, bytes);
+                    break;
+            }
+        }
+    };
+
+    PatternMatcher::PatternMatcher(const std::vector<CausalPattern>& patterns) {
+        entry.reserve(patterns.size());
+        firstBytes.resize(patterns.size());
+        fallback.resize(patterns.size());
+        patternLiterals.resize(patterns.size());
+        closingEntry.resize(patterns.size(), NoEntry);
+        closingFirstBytes.resize(patterns.size());
+        maxGap.resize(patterns.size(), 0);
+        priorities.resize(patterns.size(), 0);
+        searchedPatterns.resize(patterns.size(), true);
+        std::vector<std::vector<std::string>> patternSamples(patterns.size());
+
+        for (size_t i = 0; i < patterns.size(); i++) {
+            searchedPatterns[i] = patterns[i].parse_method != ParseMethod::Manual;
+        }
+
+        // trie of the word-sequence patterns while it is built: children by word ID, and terminals of each node
+        std::vector<std::map<uint32_t, uint32_t>> trieChildren(1);
+        std::vector<std::vector<TrieTerminal>> nodeTerminals(1);
+        std::vector<std::string> sequences;
+        std::vector<std::string> words;
+
+        for (size_t i = 0; i < patterns.size(); i++) {
+            RegexNode node;
+            RegexNode closingNode;
+            PatternCompiler compiler(patterns[i].source);
+            PatternCompiler closingCompiler(patterns[i].closing);
+            if (patterns[i].source.empty() || !compiler.parse(node)
+                || (patterns[i].gapped() && !closingCompiler.parse(closingNode))) {
+                // not in the subset: keep the std::regex for this pattern
+                entry.push_back(NoEntry);
+                fallback[i] = patterns[i].regex();
+                continue;
+            }
+            patternSamples[i] = PatternCompiler::samples(node);
+
+            bool wordSequence = !patterns[i].gapped() && PatternCompiler::wordSequences(node, sequences);
+            for (size_t k = 0; wordSequence && k < sequences.size(); k++) {
+                wordSequence = PatternCompiler::splitWords(sequences[k], words);
+            }
+            if (wordSequence) {
+                // one trie path per sequence, ranked in the order the regex would try them
+                for (size_t k = 0; k < sequences.size(); k++) {
+                    PatternCompiler::splitWords(sequences[k], words);
+                    uint32_t node = 0;
+                    for (const auto& word : words) {
+                        uint32_t id = tokenDictionary.intern(word);
+                        auto found = trieChildren[node].find(id);
+                        if (found == trieChildren[node].end()) {
+                            found = trieChildren[node].emplace(id, static_cast<uint32_t>(trieChildren.size())).first;
+                            trieChildren.emplace_back();
+                            nodeTerminals.emplace_back();
+                        }
+                        node = found->second;
+                    }
+                    nodeTerminals[node].push_back({static_cast<uint32_t>(i), static_cast<uint32_t>(k)});
+                }
+                entry.push_back(WordEntry);
+            } else {
+                unsigned int start = static_cast<unsigned int>(program.size());
+                PatternCompiler::emit(program, node);
+                program.push_back({Op::Match, 0, static_cast<unsigned int>(i), 0});
+                entry.push_back(start);
+            }
+
+            if (patterns[i].gapped()) {
+                // the closing is a separate program, matched on its own and joined to the anchors after the scan
+                closingEntry[i] = static_cast<unsigned int>(program.size());
+                PatternCompiler::emit(program, closingNode);
+                program.push_back({Op::Match, 0, static_cast<unsigned int>(i), 0});
+                maxGap[i] = patterns[i].maxGap;
+
+                std::string closingSample = PatternCompiler::samples(closingNode).front();
+                for (auto& sample : patternSamples[i]) sample += " x " + closingSample;
+            }
+
+            // index the required literals for the prefilter, shared between patterns
+            for (const auto& literal : PatternCompiler::requiredLiterals(node)) {
+                auto found = std::find(literals.begin(), literals.end(), literal);
+                patternLiterals[i].push_back(static_cast<unsigned int>(found - literals.begin()));
+                if (found == literals.end()) literals.push_back(literal);
+            }
+        }
+
+        // flatten the trie: edges sorted by word ID, so a step is a binary search in a contiguous range
+        trie.resize(trieChildren.size());
+        for (size_t node = 0; node < trieChildren.size(); node++) {
+            trie[node].edgeBegin = static_cast<uint32_t>(trieEdges.size());
+            for (const auto& child : trieChildren[node]) trieEdges.push_back({child.first, child.second});
+            trie[node].edgeEnd = static_cast<uint32_t>(trieEdges.size());
+            trie[node].terminalBegin = static_cast<uint32_t>(trieTerminals.size());
+            trieTerminals.insert(trieTerminals.end(), nodeTerminals[node].begin(), nodeTerminals[node].end());
+            trie[node].terminalEnd = static_cast<uint32_t>(trieTerminals.size());
+        }
+
+        for (size_t i = 0; i < patterns.size(); i++) {
+            if (entry[i] == NoEntry || entry[i] == WordEntry) continue;
+            std::vector<bool> visited(program.size(), false);
+            PatternCompiler::collectFirstBytes(program, entry[i], visited, firstBytes[i]);
+            if (closingEntry[i] == NoEntry) continue;
+            std::vector<bool> closingVisited(program.size(), false);
+            PatternCompiler::collectFirstBytes(program, closingEntry[i], closingVisited, closingFirstBytes[i]);
+        }
+
+        // pattern a subsumes pattern b if, in every sample that a matches completely, b matches inside of it
+        std::vector<std::vector<bool>> subsumes(patterns.size(), std::vector<bool>(patterns.size(), false));
+        for (size_t a = 0; a < patterns.size(); a++) {
+            std::vector<bool> inside(patterns.size(), true);
+            bool matchedAny = false;
+            for (const auto& sample : patternSamples[a]) {
+                // punctuation next to \b needs a word character around the sample, as in "x, so" or "Having,x"
+                bool whole = false;
+                std::vector<bool> found(patterns.size(), false);
+                for (const char* before : {"", "x"}) {
+                    for (const char* after : {"", "x"}) {
+                        if (whole) break;
+                        std::string padded = before + sample + after;
+                        size_t begin = std::strlen(before);
+                        auto hits = match(padded);
+                        for (const auto& hit : hits) {
+                            if (hit.patternIndex == a && hit.start == begin && hit.end == begin + sample.size()) whole = true;
+                        }
+                        if (!whole) continue;
+                        for (const auto& hit : hits) {
+                            if (hit.patternIndex != a && hit.start >= begin && hit.end <= begin + sample.size()) found[hit.patternIndex] = true;
+                        }
+                    }
+                }
+                // samples the pattern does not match by itself tell nothing
+                if (!whole) continue;
+                matchedAny = true;
+                for (size_t b = 0; b < patterns.size(); b++) inside[b] = inside[b] && found[b];
+            }
+            if (!matchedAny) continue;
+            for (size_t b = 0; b < patterns.size(); b++) subsumes[a][b] = inside[b] && b != a;
+        }
+
+        // priority is the depth in the subsumption order; patterns that subsume each other get no order
+        std::vector<int> state(patterns.size(), 0);
+        std::function<unsigned int(size_t)> depth = [&](size_t a) -> unsigned int {
+            if (state[a] == 2) return priorities[a];
+            state[a] = 1;
+            unsigned int result = 0;
+            for (size_t b = 0; b < patterns.size(); b++) {
+                if (subsumes[a][b] && !subsumes[b][a] && state[b] != 1) result = std::max(result, depth(b) + 1);
+            }
+            state[a] = 2;
+            priorities[a] = result;
+            return result;
+        };
+        for (size_t a = 0; a < patterns.size(); a++) depth(a);
+    }
+
+    bool PatternMatcher::Image::consistent(size_t patternCount) const {
+        const size_t instructions = program.size() / 4;
+        const size_t nodes = trie.size() / 4;
+        const size_t edges = trieEdges.size();
+        const size_t terminals = trieTerminals.size() / 2;
+        if (program.size() % 4 != 0 || patterns.size() != 5 * patternCount || firstBytes.size() != 8 * patternCount
+            || literalOffsets.size() != patternCount + 1 || trie.size() % 4 != 0 || nodes == 0
+            || trieWords.size() != edges || trieTerminals.size() % 2 != 0) {
+            return false;
+        }
+
+        for (size_t pc = 0; pc < instructions; pc++) {
+            Op op = static_cast<Op>(program[4 * pc]);
+            if (program[4 * pc] > static_cast<uint32_t>(Op::Match) || program[4 * pc + 1] > 0xFF) return false;
+            if ((op == Op::Split || op == Op::Jump) && program[4 * pc + 2] >= instructions) return false;
+            if (op == Op::Split && program[4 * pc + 3] >= instructions) return false;
+            if (op == Op::Match && program[4 * pc + 2] >= patternCount) return false;
+            // every other instruction falls through to the next one
+            if (op != Op::Match && op != Op::Jump && op != Op::Split && pc + 1 >= instructions) return false;
+        }
+        for (size_t i = 0; i < patternCount; i++) {
+            uint32_t start = patterns[5 * i];
+            uint32_t closing = patterns[5 * i + 1];
+            if (start != NoEntry && start != WordEntry && start >= instructions) return false;
+            if (closing != NoEntry && closing >= instructions) return false;
+            if (literalOffsets[i] > literalOffsets[i + 1]) return false;
+        }
+        if (literalOffsets.front() != 0 || literalOffsets.back() != literalIndices.size()) return false;
+        for (uint32_t literal : literalIndices) {
+            if (literal >= literals.size()) return false;
+        }
+        for (size_t node = 0; node < nodes; node++) {
+            const uint32_t* n = trie.data() + 4 * node;
+            if (n[0] > n[1] || n[1] > edges || n[2] > n[3] || n[3] > terminals) return false;
+        }
+        for (uint32_t child : trieEdges) {
+            if (child == 0 || child >= nodes) return false;
+        }
+        for (size_t t = 0; t < terminals; t++) {
+            if (trieTerminals[2 * t] >= patternCount) return false;
+        }
+        return true;
+    }
+
+    PatternMatcher::PatternMatcher(const std::vector<CausalPattern>& patterns, const Image& image) {
+        const size_t n = patterns.size();
+        program.resize(image.program.size() / 4);
+        for (size_t pc = 0; pc < program.size(); pc++) {
+            const uint32_t* inst = image.program.data() + 4 * pc;
+            program[pc] = {static_cast<Op>(inst[0]), static_cast<unsigned char>(inst[1]), inst[2], inst[3]};
+        }
+
+        entry.resize(n);
+        closingEntry.resize(n);
+        maxGap.resize(n);
+        priorities.resize(n);
+        searchedPatterns.resize(n);
+        firstBytes.resize(n);
+        closingFirstBytes.resize(n);
+        fallback.resize(n);
+        patternLiterals.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            const uint32_t* p = image.patterns.data() + 5 * i;
+            entry[i] = p[0];
+            closingEntry[i] = p[1];
+            maxGap[i] = p[2];
+            priorities[i] = p[3];
+            searchedPatterns[i] = p[4] != 0;
+            for (size_t bit = 0; bit < 256; bit++) {
+                firstBytes[i][bit] = (image.firstBytes[8 * i + bit / 64] >> (bit % 64)) & 1;
+                closingFirstBytes[i][bit] = (image.firstBytes[8 * i + 4 + bit / 64] >> (bit % 64)) & 1;
+            }
+            if (entry[i] == NoEntry) fallback[i] = patterns[i].regex();
+            patternLiterals[i].assign(image.literalIndices.begin() + image.literalOffsets[i],
+                image.literalIndices.begin() + image.literalOffsets[i + 1]);
+        }
+        literals = image.literals;
+
+        // intern the trie words again, then restore the order of each node's edges by word ID
+        trie.resize(image.trie.size() / 4);
+        for (size_t node = 0; node < trie.size(); node++) {
+            const uint32_t* t = image.trie.data() + 4 * node;
+            trie[node] = {t[0], t[1], t[2], t[3]};
+        }
+        trieEdges.resize(image.trieEdges.size());
+        for (size_t e = 0; e < trieEdges.size(); e++) {
+            trieEdges[e] = {tokenDictionary.intern(image.trieWords[e]), image.trieEdges[e]};
+        }
+        for (const auto& node : trie) {
+            std::sort(trieEdges.begin() + node.edgeBegin, trieEdges.begin() + node.edgeEnd,
+                [](const TrieEdge& a, const TrieEdge& b) { return a.word < b.word; });
+        }
+        trieTerminals.resize(image.trieTerminals.size() / 2);
+        for (size_t t = 0; t < trieTerminals.size(); t++) {
+            trieTerminals[t] = {image.trieTerminals[2 * t], image.trieTerminals[2 * t + 1]};
+        }
+    }
+
+    PatternMatcher::Image PatternMatcher::image(uint64_t patternSetHash) const {
+        Image result;
+        result.patternSetHash = patternSetHash;
+        for (const auto& inst : program) {
+            result.program.insert(result.program.end(), {static_cast<uint32_t>(inst.op), inst.c, inst.x, inst.y});
+        }
+
+        auto words = [](const std::bitset<256>& bytes, std::vector<uint64_t>& out) {
+            for (size_t word = 0; word < 4; word++) {
+                uint64_t bits = 0;
+                for (size_t bit = 0; bit < 64; bit++) {
+                    if (bytes[64 * word + bit]) bits |= uint64_t(1) << bit;
+                }
+                out.push_back(bits);
+            }
+        };
+        result.literalOffsets.push_back(0);
+        for (size_t i = 0; i < entry.size(); i++) {
+            result.patterns.insert(result.patterns.end(),
+                {entry[i], closingEntry[i], maxGap[i], priorities[i], searchedPatterns[i] ? 1u : 0u});
+            words(firstBytes[i], result.firstBytes);
+            words(closingFirstBytes[i], result.firstBytes);
+            result.literalIndices.insert(result.literalIndices.end(), patternLiterals[i].begin(), patternLiterals[i].end());
+            result.literalOffsets.push_back(static_cast<uint32_t>(result.literalIndices.size()));
+        }
+        result.literals = literals;
+
+        for (const auto& node : trie) {
+            result.trie.insert(result.trie.end(), {node.edgeBegin, node.edgeEnd, node.terminalBegin, node.terminalEnd});
+        }
+        // word IDs depend on what was interned first, e.g. the records loaded, so each node's edges are written
+        // in word order instead, and the image only depends on the patterns; loading sorts them by ID again
+        for (const auto& node : trie) {
+            std::vector<TrieEdge> edges(trieEdges.begin() + node.edgeBegin, trieEdges.begin() + node.edgeEnd);
+            std::sort(edges.begin(), edges.end(), [](const TrieEdge& a, const TrieEdge& b) {
+                return tokenDictionary.word(a.word) < tokenDictionary.word(b.word);
+            });
+            for (const auto& edge : edges) {
+                result.trieEdges.push_back(edge.child);
+                result.trieWords.push_back(tokenDictionary.word(edge.word));
+            }
+        }
+        for (const auto& terminal : trieTerminals) {
+            result.trieTerminals.insert(result.trieTerminals.end(), {terminal.pattern, terminal.rank});
+        }
+        return result;
+    }
+
+    // interval sweep over the matches in start order: the kept match is replaced by an overlapping one
+    // that wins on priority, then length, and is emitted once the next match starts after its end
+    std::vector<PatternMatch> PatternMatcher::resolveOverlaps(const std::vector<PatternMatch>& matches) const {
+        std::vector<PatternMatch> resolved;
+        if (matches.empty()) return resolved;
+
+        auto better = [this](const PatternMatch& a, const PatternMatch& b) {
+            if (priorities[a.patternIndex] != priorities[b.patternIndex]) return priorities[a.patternIndex] > priorities[b.patternIndex];
+            if (a.end - a.start != b.end - b.start) return a.end - a.start > b.end - b.start;
+            return a.start != b.start ? a.start < b.start : a.patternIndex < b.patternIndex;
+        };
+
+        PatternMatch kept = matches[0];
+        for (size_t i = 1; i < matches.size(); i++) {
+            const auto& next = matches[i];
+            if (next.start >= kept.end) {
+                resolved.push_back(kept);
+                kept = next;
+            } else if (better(next, kept)) {
+                kept = next;
+            }
+        }
+        resolved.push_back(kept);
+        return resolved;
+    }
+
+    size_t PatternMatcher::compiledCount() const {
+        size_t count = 0;
+        for (unsigned int e : entry) {
+            if (e != NoEntry) count++;
+        }
+        return count;
+    }
+
+    std::vector<std::string> PatternMatcher::requiredLiterals(size_t patternIndex) const {
+        std::vector<std::string> result;
+        for (unsigned int literal : patternLiterals[patternIndex]) result.push_back(literals[literal]);
+        return result;
+    }
+
+    // helper: substring test for the prefilter
+    // compares the first and last byte of the needle against 16 positions at a time with SSE2,
+    // and only checks the bytes in between where both agree
+    static bool containsLiteral(const std::string& text, const std::string& needle) {
+        const size_t n = text.size();
+        const size_t k = needle.size();
+        if (k == 0) return true;
+        if (k > n) return false;
+        if (k == 1) return std::memchr(text.data(), needle[0], n) != nullptr;
+
+        size_t pos = 0;
+#ifdef __SSE2__
+        const __m128i first = _mm_set1_epi8(needle[0]);
+        const __m128i last = _mm_set1_epi8(needle[k - 1]);
+        for (; pos + k - 1 + 16 <= n; pos += 16) {
+            __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + pos));
+            __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + pos + k - 1));
+            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last))));
+            while (mask != 0) {
+                unsigned int bit = static_cast<unsigned int>(__builtin_ctz(mask));
+                if (std::memcmp(text.data() + pos + bit + 1, needle.data() + 1, k - 2) == 0) return true;
+                mask &= mask - 1;
+            }
+        }
+#endif
+        return text.find(needle, pos) != std::string::npos;
+    }
+
+    std::vector<bool> PatternMatcher::candidatePatterns(const std::string& lowerText) const {
+        std::vector<bool> present(literals.size(), false);
+        for (size_t i = 0; i < literals.size(); i++) {
+            present[i] = containsLiteral(lowerText, literals[i]);
+        }
+
+        std::vector<bool> candidates(searchedPatterns);
+        for (size_t i = 0; i < entry.size(); i++) {
+            if (!candidates[i] || patternLiterals[i].empty()) continue;
+            bool any = false;
+            for (unsigned int literal : patternLiterals[i]) any = any || present[literal];
+            candidates[i] = any;
+        }
+        return candidates;
+    }
+
+    TokenDictionary tokenDictionary;
+
+    uint32_t TokenDictionary::intern(const std::string& word) {
+        auto inserted = ids.emplace(word, static_cast<uint32_t>(ids.size()));
+        if (inserted.second) words.push_back(&inserted.first->first);
+        return inserted.first->second;
+    }
+
+    uint32_t TokenDictionary::find(const std::string& word) const {
+        auto found = ids.find(word);
+        return found == ids.end() ? NoToken : found->second;
+    }
+
+    void segmentText(std::string_view text, TextSegments& out, bool intern) {
+        const size_t n = text.size();
+        auto space = [&text](size_t i) { return isSpaceByte(static_cast<unsigned char>(text[i])); };
+        auto punctuation = [&text](size_t i) { return std::ispunct(static_cast<unsigned char>(text[i])) != 0; };
+        auto segment = [](size_t b, size_t e) { return Segment{static_cast<uint32_t>(b), static_cast<uint32_t>(e)}; };
+
+        // tokens
+        for (size_t pos = 0; pos < n;) {
+            while (pos < n && space(pos)) pos++;
+            size_t b = pos;
+            while (pos < n && !space(pos)) pos++;
+            size_t e = pos;
+            while (b < e && punctuation(b)) b++;
+            while (e > b && punctuation(e - 1)) e--;
+            if (b < e) out.tokens.push_back(segment(b, e));
+        }
+
+        // words, lowercase
+        std::string word;
+        size_t previousEnd = n;
+        for (size_t pos = 0; pos < n;) {
+            if (!isWordByte(static_cast<unsigned char>(text[pos]))) {
+                pos++;
+                continue;
+            }
+            size_t b = pos;
+            word.clear();
+            while (pos < n && isWordByte(static_cast<unsigned char>(text[pos]))) {
+                word += static_cast<char>(toLowerByte(static_cast<unsigned char>(text[pos])));
+                pos++;
+            }
+            bool spaced = previousEnd < b;
+            for (size_t i = previousEnd; spaced && i < b; i++) spaced = space(i);
+            out.words.push_back(segment(b, pos));
+            out.wordIDs.push_back(intern ? tokenDictionary.intern(word) : tokenDictionary.find(word));
+            out.spaceBefore.push_back(spaced ? 1 : 0);
+            previousEnd = pos;
+        }
+
+        // sentences and their clauses; separators end their clause, sentence punctuation is part of it
+        size_t sentence = n;
+        size_t clause = n;
+        size_t last = 0;
+        for (size_t pos = 0; pos < n; pos++) {
+            if (space(pos)) continue;
+            if (sentence == n) sentence = pos;
+            if (clause == n) clause = pos;
+            char c = text[pos];
+            bool boundary = pos + 1 == n || space(pos + 1);
+            if (c == ';' && boundary) {
+                if (clause < pos) out.clauses.push_back(segment(clause, last));
+                clause = n;
+            } else if ((c == '.' || c == '!' || c == '?') && boundary) {
+                out.clauses.push_back(segment(clause, pos + 1));
+                out.sentences.push_back(segment(sentence, pos + 1));
+                sentence = n;
+                clause = n;
+            }
+            last = pos + 1;
+        }
+        if (clause != n) out.clauses.push_back(segment(clause, last));
+        if (sentence != n) out.sentences.push_back(segment(sentence, last));
+    }
+
+    // helper: index of the last segment that starts at or before pos, 0 if there is none
+    static size_t segmentAt(const Segment* segments, size_t count, size_t pos) {
+        const Segment* after = std::upper_bound(segments, segments + count, pos,
+            [](size_t p, const Segment& segment) { return p < segment.start; });
+        return after == segments ? 0 : static_cast<size_t>(after - segments - 1);
+    }
+
+    size_t SegmentView::tokensBetween(size_t from, size_t to) const {
+        if (to <= from) return 0;
+        auto startsBefore = [](const Segment& segment, size_t p) { return segment.start < p; };
+        return static_cast<size_t>(std::lower_bound(tokens, tokens + tokenCount, to, startsBefore)
+            - std::lower_bound(tokens, tokens + tokenCount, from, startsBefore));
+    }
+
+    size_t SegmentView::sentenceAt(size_t pos) const {
+        return segmentAt(sentences, sentenceCount, pos);
+    }
+
+    size_t SegmentView::clauseAt(size_t pos) const {
+        return segmentAt(clauses, clauseCount, pos);
+    }
+
+    // follow jumps, splits, and assertions from pc at text position pos, and add the resulting threads to list
+    // marks stop a program counter from being added twice at the same position, so each step is linear in the program size
+    void PatternMatcher::addThread(std::vector<Thread>& list, std::vector<size_t>& marks, unsigned int pc, size_t start,
+        const std::string& text, size_t pos) const {
+        if (marks[pc] == pos + 1) return;
+        marks[pc] = pos + 1;
+
+        const auto& inst = program[pc];
+        switch (inst.op) {
+            case Op::Jump:
+                addThread(list, marks, inst.x, start, text, pos);
+                break;
+            case Op::Split:
+                addThread(list, marks, inst.x, start, text, pos);
+                addThread(list, marks, inst.y, start, text, pos);
+                break;
+            case Op::WordBoundary:
+            case Op::NotWordBoundary: {
+                bool before = pos > 0 && isWordByte(text[pos - 1]);
+                bool after = pos < text.size() && isWordByte(text[pos]);
+                if ((before != after) == (inst.op == Op::WordBoundary)) {
+                    addThread(list, marks, pc + 1, start, text, pos);
+                }
+                break;
+            }
+            default:
+                list.push_back({pc, start});
+                break;
+        }
+    }
+
+    void PatternMatcher::step(PatternState& state, std::vector<size_t>& marks, const std::string& text, size_t pos,
+        std::vector<PatternMatch>& matches) const {
+        const size_t n = text.size();
+        unsigned char c = pos < n ? static_cast<unsigned char>(text[pos]) : 0;
+
+        // start a new lowest priority thread here unless a match is already being extended
+        const auto& first = state.closing ? closingFirstBytes[state.index] : firstBytes[state.index];
+        if (!state.matched && pos >= state.searchFrom && (pos < n ? first.test(c) : first.all())) {
+            addThread(state.current, marks, state.closing ? closingEntry[state.index] : entry[state.index], pos, text, pos);
+        }
+        if (state.current.empty()) return;
+
+        for (const auto& thread : state.current) {
+            const auto& inst = program[thread.pc];
+            if (inst.op == Op::Match) {
+                // threads after this one have lower priority and are dropped
+                state.matched = true;
+                state.matchStart = thread.start;
+                state.matchEnd = pos;
+                break;
+            }
+            if (pos >= n) continue;
+            bool accepted = (inst.op == Op::Char && inst.c == c)
+                || (inst.op == Op::Space && isSpaceByte(c))
+                || (inst.op == Op::Any && c != '\n' && c != '\r');
+            if (accepted) {
+                addThread(state.next, marks, thread.pc + 1, thread.start, text, pos + 1);
+            }
+        }
+        state.current.swap(state.next);
+        state.next.clear();
+
+        // once no higher priority thread is left, the match is final
+        if (state.matched && state.current.empty()) {
+            matches.emplace_back(state.index, state.matchStart, state.matchEnd);
+            state.matched = false;
+            state.searchFrom = state.matchEnd > state.matchStart ? state.matchEnd : state.matchEnd + 1;
+        }
+    }
+
+    // leftmost-first and non-overlapping per pattern, like the program: from each word, the trie is walked
+    // as long as the next word follows after whitespace only, and of the sequences of a pattern that end
+    // on the way, the one the regex would try first is kept
+    void PatternMatcher::matchWords(const SegmentView& segments, const std::vector<bool>& candidates,
+        std::vector<PatternMatch>& matches) const {
+        std::vector<size_t> nextWord(entry.size(), 0);
+        // pattern, rank, and last word of the sequences found from the current word
+        struct Found {
+            uint32_t pattern;
+            uint32_t rank;
+            size_t last;
+        };
+        std::vector<Found> found;
+
+        for (size_t w = 0; w < segments.wordCount; w++) {
+            found.clear();
+            uint32_t node = 0;
+            for (size_t k = w; k < segments.wordCount; k++) {
+                if (k > w && !segments.spaceBefore[k]) break;
+                const TrieEdge* first = trieEdges.data() + trie[node].edgeBegin;
+                const TrieEdge* last = trieEdges.data() + trie[node].edgeEnd;
+                const TrieEdge* edge = std::lower_bound(first, last, segments.wordIDs[k],
+                    [](const TrieEdge& e, uint32_t word) { return e.word < word; });
+                if (edge == last || edge->word != segments.wordIDs[k]) break;
+                node = edge->child;
+                for (uint32_t t = trie[node].terminalBegin; t < trie[node].terminalEnd; t++) {
+                    const auto& terminal = trieTerminals[t];
+                    if (candidates[terminal.pattern] && w >= nextWord[terminal.pattern]) {
+                        found.push_back({terminal.pattern, terminal.rank, k});
+                    }
+                }
+            }
+            if (found.empty()) continue;
+
+            std::sort(found.begin(), found.end(), [](const Found& a, const Found& b) {
+                return a.pattern != b.pattern ? a.pattern < b.pattern : a.rank < b.rank;
+            });
+            for (size_t f = 0; f < found.size(); f++) {
+                if (f > 0 && found[f].pattern == found[f - 1].pattern) continue;
+                matches.emplace_back(found[f].pattern, segments.words[w].start, segments.words[found[f].last].end);
+                nextWord[found[f].pattern] = found[f].last + 1;
+            }
+        }
+    }
+
+    // a gapped match is an anchor followed by the first closing after it, if the closing starts a token,
+    // and is separated from the anchor by 1 to maxGap tokens in the same sentence
+    // anchors and closings are in text order, so one merge pass joins them: the closing, token, and sentence
+    // cursors only move forward, and the pass is linear in the hits and segments
+    void PatternMatcher::joinGaps(const std::string& text, const SegmentView& segments, size_t pattern,
+        const std::vector<PatternMatch>& anchors, const std::vector<PatternMatch>& closings, std::vector<PatternMatch>& matches) const {
+        // first token that starts at or after pos, and the sentence at pos
+        struct Cursor {
+            size_t token = 0;
+            size_t sentence = 0;
+        };
+        auto advance = [&segments](Cursor& cursor, size_t pos) {
+            while (cursor.token < segments.tokenCount && segments.tokens[cursor.token].start < pos) cursor.token++;
+            while (cursor.sentence + 1 < segments.sentenceCount && segments.sentences[cursor.sentence + 1].start <= pos) cursor.sentence++;
+        };
+        Cursor atAnchor;
+        Cursor atClosing;
+
+        size_t k = 0;
+        size_t searchFrom = 0;
+        for (const auto& anchor : anchors) {
+            // non-overlapping: an anchor inside the previous match is skipped
+            if (anchor.start < searchFrom) continue;
+
+            // first closing that starts a token after the anchor; anchors end in text order, so k never moves back
+            while (k < closings.size() && (closings[k].start <= anchor.end
+                || !isSpaceByte(static_cast<unsigned char>(text[closings[k].start - 1])))) k++;
+            if (k == closings.size()) break;
+
+            const auto& closing = closings[k];
+            advance(atAnchor, anchor.end);
+            advance(atClosing, closing.start);
+            size_t gap = atClosing.token - atAnchor.token;
+            if (gap < 1 || gap > maxGap[pattern] || atClosing.sentence != atAnchor.sentence) continue;
+
+            matches.emplace_back(pattern, anchor.start, closing.end);
+            searchFrom = closing.end;
+        }
+    }
+
+    // one pass over the text for all compiled patterns at once (Pike VM simulation of the union NFA)
+    // each pattern keeps its own thread list in priority order, so every pattern gets the same
+    // leftmost-first, non-overlapping matches that std::regex_iterator would return
+    std::vector<PatternMatch> PatternMatcher::match(std::string_view text, PatternProfile* profile, const SegmentView* segments) const {
+        std::vector<PatternMatch> matches;
+
+        // lowercase once instead of comparing case-insensitively in every thread
+        std::string lower(text);
+        for (auto& ch : lower) ch = static_cast<char>(toLowerByte(static_cast<unsigned char>(ch)));
+
+        // only patterns with a required literal in the text can match
+        std::vector<bool> candidates = candidatePatterns(lower);
+
+        // gapped patterns run their anchor and their closing as two states
+        std::vector<PatternState> states;
+        for (size_t i = 0; i < entry.size(); i++) {
+            if (entry[i] == NoEntry || entry[i] == WordEntry || !candidates[i]) continue;
+            states.push_back({i, false, {}, {}, 0, false, 0, 0});
+            if (closingEntry[i] != NoEntry) states.push_back({i, true, {}, {}, 0, false, 0, 0});
+        }
+
+        std::vector<size_t> marks(program.size(), 0);
+        const size_t n = lower.size();
+        // hits of the anchor and closing states of gapped patterns, by state; each state finds them in text order
+        std::vector<std::vector<PatternMatch>> gapHits(states.size());
+        auto output = [&](const PatternState& state) -> std::vector<PatternMatch>& {
+            if (closingEntry[state.index] == NoEntry) return matches;
+            return gapHits[static_cast<size_t>(&state - states.data())];
+        };
+
+        if (!profile) {
+            for (size_t pos = 0; pos <= n; pos++) {
+                for (auto& state : states) step(state, marks, lower, pos, output(state));
+            }
+        } else {
+            // the programs of different patterns share no instructions, so scanning them one at a time
+            // gives the same matches
+            for (size_t s = 0; s < states.size(); s++) {
+                auto begin = std::chrono::steady_clock::now();
+                for (size_t pos = 0; pos <= n; pos++) step(states[s], marks, lower, pos, output(states[s]));
+                // the closing of a gapped pattern follows its anchor, and counts as part of the same evaluation
+                if (s + 1 < states.size() && states[s + 1].closing) {
+                    s++;
+                    for (size_t pos = 0; pos <= n; pos++) step(states[s], marks, lower, pos, output(states[s]));
+                }
+                auto elapsed = std::chrono::steady_clock::now() - begin;
+                profile->addScan(states[s].index, n, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            }
+        }
+
+        // segments of the text, computed here only if they were not given and are needed
+        TextSegments own;
+        SegmentView view = segments ? *segments : SegmentView();
+        bool ready = segments != nullptr;
+        auto segmented = [&]() -> const SegmentView& {
+            if (!ready) {
+                segmentText(text, own);
+                view = SegmentView(own);
+                ready = true;
+            }
+            return view;
+        };
+
+        // the anchor state of a gapped pattern is followed by its closing state
+        for (size_t s = 0; s + 1 < states.size(); s++) {
+            if (!states[s + 1].closing || gapHits[s].empty() || gapHits[s + 1].empty()) continue;
+            joinGaps(lower, segmented(), states[s].index, gapHits[s], gapHits[s + 1], matches);
+        }
+
+        // word-sequence patterns: one walk of the trie from each word
+        if (trie.size() > 1) {
+            auto begin = std::chrono::steady_clock::now();
+            matchWords(segmented(), candidates, matches);
+            if (profile) {
+                // the walk is shared, so its time is split evenly between the patterns it evaluated
+                std::vector<size_t> evaluated;
+                for (size_t i = 0; i < entry.size(); i++) {
+                    if (entry[i] == WordEntry && candidates[i]) evaluated.push_back(i);
+                }
+                auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+                for (size_t i : evaluated) profile->addScan(i, n, static_cast<uint64_t>(elapsed) / evaluated.size());
+            }
+        }
+
+        // patterns outside of the subset
+        for (size_t i = 0; i < entry.size(); i++) {
+            if (entry[i] != NoEntry || !candidates[i]) continue;
+            auto begin = std::chrono::steady_clock::now();
+            for (auto it = std::cregex_iterator(text.data(), text.data() + text.size(), fallback[i]); it != std::cregex_iterator(); ++it) {
+                size_t start = static_cast<size_t>(it->position());
+                matches.emplace_back(i, start, start + static_cast<size_t>(it->length()));
+            }
+            if (profile) {
+                auto elapsed = std::chrono::steady_clock::now() - begin;
+                profile->addScan(i, n, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            }
+        }
+
+        std::sort(matches.begin(), matches.end(), [](const PatternMatch& a, const PatternMatch& b) {
+            return a.start != b.start ? a.start < b.start : a.patternIndex < b.patternIndex;
+        });
+        if (profile) {
+            for (const auto& m : matches) profile->addHit(m.patternIndex);
+        }
+        return matches;
+    }
+
+    PatternProfile::PatternProfile(size_t patternCount) : counters(patternCount) {}
+
+    void PatternProfile::addScan(size_t patternIndex, uint64_t bytes, uint64_t nanoseconds) {
+        auto& c = counters[patternIndex];
+        c.evaluations.fetch_add(1, std::memory_order_relaxed);
+        c.bytes.fetch_add(bytes, std::memory_order_relaxed);
+        c.nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    }
+
+    void PatternProfile::addDecisions(size_t patternIndex, uint64_t verified, uint64_t rejected) {
+        counters[patternIndex].verified.fetch_add(verified, std::memory_order_relaxed);
+        counters[patternIndex].rejected.fetch_add(rejected, std::memory_order_relaxed);
+    }
+
+    PatternProfile::Counters PatternProfile::operator[](size_t patternIndex) const {
+        const auto& c = counters[patternIndex];
+        return {c.evaluations.load(std::memory_order_relaxed), c.bytes.load(std::memory_order_relaxed),
+            c.nanoseconds.load(std::memory_order_relaxed), c.hits.load(std::memory_order_relaxed),
+            c.verified.load(std::memory_order_relaxed), c.rejected.load(std::memory_order_relaxed)};
+    }
+
+    std::vector<size_t> PatternProfile::byCost() const {
+        std::vector<size_t> order;
+        for (size_t i = 0; i < counters.size(); i++) {
+            if ((*this)[i].evaluations > 0) order.push_back(i);
+        }
+        std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+            Counters ca = (*this)[a];
+            Counters cb = (*this)[b];
+            return ca.nanoseconds != cb.nanoseconds ? ca.nanoseconds > cb.nanoseconds : ca.hits > cb.hits;
+        });
+        return order;
+    }
+
+    void PatternProfile::writeTable(std::ostream& out, const std::vector<CausalPattern>& patterns) const {
+        out << std::left << std::setw(10) << "time (ms)" << std::setw(10) << "ns/byte" << std::setw(8) << "evals"
+            << std::setw(8) << "hits" << std::setw(9) << "verified" << std::setw(9) << "rejected" << "pattern" << std::endl;
+        for (size_t i : byCost()) {
+            Counters c = (*this)[i];
+            double nsPerByte = c.bytes > 0 ? static_cast<double>(c.nanoseconds) / static_cast<double>(c.bytes) : 0.0;
+            std::ostringstream ms;
+            ms << std::fixed << std::setprecision(2) << static_cast<double>(c.nanoseconds) / 1e6;
+            std::ostringstream perByte;
+            perByte << std::fixed << std::setprecision(2) << nsPerByte;
+            out << std::setw(10) << ms.str() << std::setw(10) << perByte.str() << std::setw(8) << c.evaluations
+                << std::setw(8) << c.hits << std::setw(9) << c.verified << std::setw(9) << c.rejected
+                << (i < patterns.size() ? patterns[i].description : "") << std::endl;
+        }
+        out << std::right;
+    }
+
+    nlohmann::ordered_json PatternProfile::toJSON(const std::vector<CausalPattern>& patterns) const {
+        nlohmann::ordered_json report = nlohmann::ordered_json::array();
+        for (size_t i : byCost()) {
+            Counters c = (*this)[i];
+            nlohmann::ordered_json ids = nlohmann::ordered_json::array();
+            if (i < patterns.size()) {
+                for (const auto& id : patterns[i].ids) ids.push_back(id.str());
+            }
+            uint64_t decided = c.verified + c.rejected;
+            report.push_back({
+                {"pattern", i < patterns.size() ? patterns[i].description : ""},
+                {"ids", ids},
+                {"parse_method", i < patterns.size() ? parseMethodToString(patterns[i].parse_method) : ""},
+                {"evaluations", c.evaluations},
+                {"bytes", c.bytes},
+                {"nanoseconds", c.nanoseconds},
+                {"hits", c.hits},
+                {"verified", c.verified},
+                {"rejected", c.rejected},
+                {"rejection_rate", decided > 0 ? static_cast<double>(c.rejected) / static_cast<double>(decided) : 0.0}
+            });
+        }
+        return report;
+    }
+
+    std::vector<std::string> inflect(std::string_view lemma) {
+        std::string base(lemma);
+        auto endsWith = [&base](std::string_view suffix) {
+            return base.size() >= suffix.size() && base.compare(base.size() - suffix.size(), suffix.size(), suffix) == 0;
+        };
+        auto vowel = [](char c) { return c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u'; };
+        bool consonantY = base.size() > 1 && base.back() == 'y' && !vowel(base[base.size() - 2]);
+
+        // regular forms
+        std::string third = consonantY ? base.substr(0, base.size() - 1) + "ies"
+            : (endsWith("s") || endsWith("x") || endsWith("z") || endsWith("ch") || endsWith("sh") || endsWith("o")) ? base + "es"
+            : base + "s";
+        std::string past = consonantY ? base.substr(0, base.size() - 1) + "ied" : endsWith("e") ? base + "d" : base + "ed";
+        std::string participle = past;
+        std::string gerund = endsWith("ie") ? base.substr(0, base.size() - 2) + "ying"
+            : (endsWith("e") && !endsWith("ee") && !endsWith("ye") && !endsWith("oe") && base.size() > 2) ? base.substr(0, base.size() - 1) + "ing"
+            : base + "ing";
+
+        // irregular forms
+        for (const auto& entry : InitialLexicon::entries) {
+            if (entry.lemma != lemma) continue;
+            if (!entry.third.empty()) third = std::string(entry.third);
+            if (!entry.past.empty()) past = participle = std::string(entry.past);
+            if (!entry.participle.empty()) participle = std::string(entry.participle);
+            if (!entry.gerund.empty()) gerund = std::string(entry.gerund);
+            break;
+        }
+
+        std::vector<std::string> forms;
+        for (const std::string& form : {base, third, past, participle, gerund}) {
+            if (std::find(forms.begin(), forms.end(), form) == forms.end()) forms.push_back(form);
         }
+        return forms;
     }
 
-    const CausalConstruction* findConstructionByID(const std::string& id) {
-        for (auto& construction : constructions) {
-            if (construction.id == id) {
-                return &construction;
+    std::string expandLemmas(const std::string& source) {
+        std::string expanded;
+        for (size_t pos = 0; pos < source.size(); pos++) {
+            size_t close = source[pos] == '{' ? source.find('}', pos) : std::string::npos;
+            bool lemma = close != std::string::npos && close > pos + 1;
+            for (size_t i = pos + 1; lemma && i < close; i++) lemma = source[i] >= 'a' && source[i] <= 'z';
+            // an escaped brace is a literal
+            if (!lemma || (pos > 0 && source[pos - 1] == '\\')) {
+                expanded += source[pos];
+                continue;
             }
+            expanded += '(';
+            for (const auto& form : inflect(std::string_view(source).substr(pos + 1, close - pos - 1))) {
+                if (expanded.back() != '(') expanded += '|';
+                expanded += form;
+            }
+            expanded += ')';
+            pos = close;
         }
-        return nullptr;
+        return expanded;
     }
 
-    // patterns
-    void addPattern(const CausalPattern& newPattern) {
+    std::regex gappedRegex(const std::string& anchor, unsigned int maxGap, const std::string& closing) {
+        // a gap token is a run of non-space bytes that does not end with sentence punctuation
+        std::string source = "(?:" + anchor + R"()(?:\s+(?:[^\s.!?]|[.!?](?=\S))+){1,)" + std::to_string(maxGap)
+            + R"(}?\s+(?:)" + closing + ")";
+        return std::regex(source, std::regex::icase);
+    }
+
+    const std::regex& CausalPattern::regex() const {
+        if (!compiled) {
+            compiled = std::make_shared<const std::regex>(gapped() ? gappedRegex(source, maxGap, closing)
+                : std::regex(source, std::regex::icase));
+        }
+        return *compiled;
+    }
+
+    uint64_t patternSetHash(const std::vector<CausalPattern>& patterns) {
+        // FNV-1a, 64 bit, over the fields of each pattern separated by unit and record separators
+        uint64_t hash = 14695981039346656037ull;
+        auto add = [&hash](const std::string& text) {
+            for (unsigned char c : text) {
+                hash = (hash ^ c) * 1099511628211ull;
+            }
+        };
+        add("v" + std::to_string(PatternMatcher::FormatVersion) + "\x1e");
         for (const auto& pattern : patterns) {
-            if (pattern.description == newPattern.description) {
-                std::cerr << "Warning: Pattern '" << pattern.description << "' already exists. Skipping." << std::endl;
-                return;
+            add(pattern.source.empty() ? pattern.description : pattern.source);
+            add("\x1f" + pattern.closing + "\x1f" + std::to_string(pattern.maxGap)
+                + "\x1f" + parseMethodToString(pattern.parse_method) + "\x1e");
+        }
+        return hash;
+    }
+
+    // the tables generated by pattern_codegen, as a matcher image
+    static PatternMatcher::Image generatedImage() {
+        namespace G = GeneratedMatcher;
+        PatternMatcher::Image image;
+        image.patternSetHash = G::patternSetHash;
+        image.program.assign(G::program.begin(), G::program.end());
+        image.patterns.assign(G::patterns.begin(), G::patterns.end());
+        image.firstBytes.assign(G::firstBytes.begin(), G::firstBytes.end());
+        image.literals.assign(G::literals.begin(), G::literals.end());
+        image.literalOffsets.assign(G::literalOffsets.begin(), G::literalOffsets.end());
+        image.literalIndices.assign(G::literalIndices.begin(), G::literalIndices.end());
+        image.trie.assign(G::trie.begin(), G::trie.end());
+        image.trieEdges.assign(G::trieEdges.begin(), G::trieEdges.end());
+        image.trieWords.assign(G::trieWords.begin(), G::trieWords.end());
+        image.trieTerminals.assign(G::trieTerminals.begin(), G::trieTerminals.end());
+        return image;
+    }
+
+    bool writeMatcherCache(const std::string& path, const PatternMatcher::Image& image, size_t patternCount) {
+        // helper: pad the output to the next multiple of 8 bytes
+        auto align = [](uint64_t offset) { return (offset + 7) & ~static_cast<uint64_t>(7); };
+
+        // string arrays as offset columns and text
+        auto flatten = [](const std::vector<std::string>& strings, std::vector<uint32_t>& offsets, std::string& text) {
+            offsets.push_back(0);
+            for (const auto& string : strings) {
+                text += string;
+                offsets.push_back(static_cast<uint32_t>(text.size()));
             }
+        };
+        std::vector<uint32_t> literalTextOffsets;
+        std::vector<uint32_t> trieWordOffsets;
+        std::string literalText;
+        std::string trieWordText;
+        flatten(image.literals, literalTextOffsets, literalText);
+        flatten(image.trieWords, trieWordOffsets, trieWordText);
+
+        struct Section {
+            const void* data;
+            size_t count;
+            size_t size;
+        };
+        const Section sections[MatcherCacheSections] = {
+            {image.program.data(), image.program.size(), sizeof(uint32_t)},
+            {image.patterns.data(), image.patterns.size(), sizeof(uint32_t)},
+            {image.firstBytes.data(), image.firstBytes.size(), sizeof(uint64_t)},
+            {image.literalOffsets.data(), image.literalOffsets.size(), sizeof(uint32_t)},
+            {image.literalIndices.data(), image.literalIndices.size(), sizeof(uint32_t)},
+            {literalTextOffsets.data(), literalTextOffsets.size(), sizeof(uint32_t)},
+            {literalText.data(), literalText.size(), 1},
+            {image.trie.data(), image.trie.size(), sizeof(uint32_t)},
+            {image.trieEdges.data(), image.trieEdges.size(), sizeof(uint32_t)},
+            {trieWordOffsets.data(), trieWordOffsets.size(), sizeof(uint32_t)},
+            {trieWordText.data(), trieWordText.size(), 1},
+            {image.trieTerminals.data(), image.trieTerminals.size(), sizeof(uint32_t)},
+        };
+
+        MatcherCacheHeader header = {};
+        std::memcpy(header.magic, MatcherCacheMagic, sizeof(MatcherCacheMagic));
+        header.version = MatcherCacheVersion;
+        header.patternCount = static_cast<uint32_t>(patternCount);
+        header.patternSetHash = image.patternSetHash;
+        uint64_t offset = align(sizeof(MatcherCacheHeader));
+        for (size_t k = 0; k < MatcherCacheSections; k++) {
+            header.sectionOffsets[k] = offset;
+            header.sectionCounts[k] = sections[k].count;
+            offset = align(offset + sections[k].count * sections[k].size);
         }
-        patterns.push_back(newPattern);
+
+        // write to a temporary file and rename it, so readers never map a half-written cache
+        std::string temporary = path + ".tmp";
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+
+        const char zeros[8] = {};
+        auto pad = [&file, &zeros](uint64_t to) {
+            uint64_t at = static_cast<uint64_t>(file.tellp());
+            if (to > at) file.write(zeros, static_cast<std::streamsize>(to - at));
+        };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (size_t k = 0; k < MatcherCacheSections; k++) {
+            pad(header.sectionOffsets[k]);
+            file.write(static_cast<const char*>(sections[k].data), static_cast<std::streamsize>(sections[k].count * sections[k].size));
+        }
+        file.close();
+
+        if (!file || std::rename(temporary.c_str(), path.c_str()) != 0) {
+            std::remove(temporary.c_str());
+            return false;
+        }
+        return true;
     }
 
-    std::vector<CausalPattern>& getPatterns() {
-        return patterns;
+    bool readMatcherCache(const std::string& path, uint64_t patternSetHash, size_t patternCount, PatternMatcher::Image& image) {
+        Annotator::MappedFile file(path);
+        if (file.size() < sizeof(MatcherCacheHeader)) return false;
+        const auto* header = reinterpret_cast<const MatcherCacheHeader*>(file.data());
+        if (std::memcmp(header->magic, MatcherCacheMagic, sizeof(MatcherCacheMagic)) != 0 || header->version != MatcherCacheVersion
+            || header->patternSetHash != patternSetHash || header->patternCount != patternCount) {
+            return false;
+        }
+
+        const size_t sizes[MatcherCacheSections] = {4, 4, 8, 4, 4, 4, 1, 4, 4, 4, 1, 4};
+        for (size_t k = 0; k < MatcherCacheSections; k++) {
+            uint64_t offset = header->sectionOffsets[k];
+            uint64_t count = header->sectionCounts[k];
+            if (offset % 8 != 0 || offset > file.size() || count > (file.size() - offset) / sizes[k]) return false;
+        }
+
+        // sections are aligned, so the numbers are read in place
+        auto section = [&file, header](size_t k, auto& out) {
+            using T = typename std::decay_t<decltype(out)>::value_type;
+            const T* begin = reinterpret_cast<const T*>(file.data() + header->sectionOffsets[k]);
+            out.assign(begin, begin + header->sectionCounts[k]);
+        };
+        auto strings = [&file, header](size_t offsetsSection, size_t textSection, std::vector<std::string>& out) {
+            const auto* offsets = reinterpret_cast<const uint32_t*>(file.data() + header->sectionOffsets[offsetsSection]);
+            const char* text = file.data() + header->sectionOffsets[textSection];
+            uint64_t count = header->sectionCounts[offsetsSection];
+            if (count == 0) return false;
+            for (uint64_t i = 0; i + 1 < count; i++) {
+                if (offsets[i] > offsets[i + 1] || offsets[i + 1] > header->sectionCounts[textSection]) return false;
+                out.emplace_back(text + offsets[i], offsets[i + 1] - offsets[i]);
+            }
+            return true;
+        };
+
+        PatternMatcher::Image loaded;
+        loaded.patternSetHash = header->patternSetHash;
+        section(0, loaded.program);
+        section(1, loaded.patterns);
+        section(2, loaded.firstBytes);
+        section(3, loaded.literalOffsets);
+        section(4, loaded.literalIndices);
+        section(7, loaded.trie);
+        section(8, loaded.trieEdges);
+        section(11, loaded.trieTerminals);
+        if (!strings(5, 6, loaded.literals) || !strings(9, 10, loaded.trieWords)) return false;
+
+        image = std::move(loaded);
+        return true;
+    }
+
+    // path of the matcher cache, or "" for none
+    static std::string matcherCachePath;
+
+    void setMatcherCachePath(const std::string& path) {
+        matcherCachePath = path;
+    }
+
+    const PatternMatcher& getMatcher() {
+        if (matcherStale || matcher.size() != patterns.size()) {
+            // the generated tables only fit the pattern set they were generated from; any other pattern set
+            // (patterns added or changed during a session, or patterns.h edited without re-running pattern_codegen)
+            // is loaded from the cache if one is set and an earlier process compiled it, and compiled (and cached) otherwise
+            // patterns built from a compiled regex only are not hashed by their regex, so sets with them are always compiled
+            bool hashable = std::all_of(patterns.begin(), patterns.end(), [](const CausalPattern& p) { return !p.source.empty(); });
+            uint64_t hash = patternSetHash(patterns);
+            PatternMatcher::Image image;
+            if (hashable && hash == GeneratedMatcher::patternSetHash) {
+                image = generatedImage();
+            } else if (hashable && !matcherCachePath.empty()) {
+                readMatcherCache(matcherCachePath, hash, patterns.size(), image);
+            }
+
+            if (hashable && image.patternSetHash == hash && image.consistent(patterns.size())) {
+                matcher = PatternMatcher(patterns, image);
+            } else {
+                matcher = PatternMatcher(patterns);
+                if (hashable && !matcherCachePath.empty()) writeMatcherCache(matcherCachePath, matcher.image(hash), patterns.size());
+            }
+            matcherStale = false;
+        }
+        return matcher;
     }
 
     // initialize constructions and patterns
     struct ConstructiconInitializer {
         ConstructiconInitializer() {
-            // load all constructions
-            for (const auto& c : InitialConstructions::constructions) {
-                addConstruction(c);
-            }
+            // constructions need no loading: the table and its ID index are built at compile time
             // load all patterns
             for (const auto& p : InitialPatterns::patterns) {
                 addPattern(p);
             }
             std::cout << "Constructicon initialized: " 
-            << constructions.size() << " constructions, "
+            << InitialConstructions::count << " constructions, "
             << patterns.size() << " patterns" << std::endl;
         }
     };
@@ -69,40 +1787,479 @@ namespace CausalConstructicon {
 }
 
 namespace Annotator {
+    RecordStore recordStore;
     std::vector<Record> records;
-    std::vector<AnnotationEntry> annotations;
+    SegmentIndex segmentIndex;
+    AnnotationStore annotations;
+    SpanPool spanPool;
+    AnnotationLog annotationLog;
+    DecisionLog decisionLog;
+    std::vector<AnnotationStore::PatternDecisions> patternDecisions;
+    PersistenceWriter persistenceWriter(annotationLog, decisionLog);
+    RecordPrefetcher recordPrefetcher;
+
+    MappedFile::MappedFile(const std::string& path) : bytes(nullptr), length(0) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+
+        struct stat info;
+        if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapped = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+            if (mapped != MAP_FAILED) {
+                bytes = static_cast<const char*>(mapped);
+                length = static_cast<size_t>(info.st_size);
+            }
+        }
+        // the mapping stays valid after the descriptor is closed
+        ::close(fd);
+    }
+
+    MappedFile::~MappedFile() {
+        if (bytes) ::munmap(const_cast<char*>(bytes), length);
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept : bytes(other.bytes), length(other.length) {
+        other.bytes = nullptr;
+        other.length = 0;
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            if (bytes) ::munmap(const_cast<char*>(bytes), length);
+            bytes = other.bytes;
+            length = other.length;
+            other.bytes = nullptr;
+            other.length = 0;
+        }
+        return *this;
+    }
+
+    TextSpan locateSpan(std::string_view text, std::string_view span) {
+        size_t pos = span.empty() ? std::string_view::npos : text.find(span);
+        if (pos == std::string_view::npos) {
+            return span.empty() ? TextSpan() : spanPool.keep(span);
+        }
+        return TextSpan(static_cast<uint32_t>(pos), static_cast<uint32_t>(pos + span.size()));
+    }
+
+    uint32_t findRecordIndex(int recordID) {
+        // built on first use, and again if records were loaded since
+        static std::unordered_map<int, uint32_t> index;
+        static size_t indexed = 0;
+        if (indexed != records.size()) {
+            index.clear();
+            index.reserve(records.size());
+            for (size_t i = 0; i < records.size(); i++) {
+                index.emplace(records[i].recordID, static_cast<uint32_t>(i));
+            }
+            indexed = records.size();
+        }
+
+        auto found = index.find(recordID);
+        return found == index.end() ? NoRecord : found->second;
+    }
+
+    AnnotationEntry::AnnotationEntry(CausalConstructicon::ConstructionHandle cid, int r,
+        std::string_view t, std::string_view ca, std::string_view e, AnnotationStatus s, ParseMethod m) :
+    constructionID(cid), recordID(r), recordIndex(findRecordIndex(r)), status(s), parse_method(m) {
+        // without the record every text is pooled
+        std::string_view statement = recordIndex == NoRecord ? std::string_view() : records[recordIndex].probableCause;
+        trigger = locateSpan(statement, t);
+        cause = locateSpan(statement, ca);
+        effect = locateSpan(statement, e);
+    }
+
+    std::string_view AnnotationEntry::text(const TextSpan& span) const {
+        if (span.pooled()) {
+            return span.end < spanPool.texts.size() ? std::string_view(spanPool.texts[span.end]) : std::string_view();
+        }
+        if (recordIndex >= records.size()) return std::string_view();
+
+        std::string_view statement = records[recordIndex].probableCause;
+        if (span.start > span.end || span.end > statement.size()) return std::string_view();
+        return statement.substr(span.start, span.end - span.start);
+    }
+
+    size_t AnnotationStore::add(const AnnotationEntry& entry) {
+        uint32_t row = static_cast<uint32_t>(size());
+        constructionIDs.push_back(entry.constructionID);
+        recordIDs.push_back(entry.recordID);
+        recordIndices.push_back(entry.recordIndex);
+        triggers.push_back(entry.trigger);
+        causes.push_back(entry.cause);
+        effects.push_back(entry.effect);
+        statuses.push_back(entry.status);
+        methods.push_back(entry.parse_method);
+        patternIndices.push_back(entry.patternIndex);
+
+        recordRows[entry.recordID].push_back(row);
+        if (entry.constructionID.valid()) {
+            if (entry.constructionID.value >= constructionRows.size()) {
+                constructionRows.resize(entry.constructionID.value + 1);
+            }
+            constructionRows[entry.constructionID.value].push_back(row);
+        }
+        return row;
+    }
+
+    AnnotationEntry AnnotationStore::operator[](size_t i) const {
+        AnnotationEntry entry(constructionIDs[i], recordIDs[i], recordIndices[i], triggers[i], causes[i], effects[i],
+            statuses[i], methods[i]);
+        entry.patternIndex = patternIndices[i];
+        return entry;
+    }
+
+    void AnnotationStore::reserve(size_t n) {
+        constructionIDs.reserve(n);
+        recordIDs.reserve(n);
+        recordIndices.reserve(n);
+        triggers.reserve(n);
+        causes.reserve(n);
+        effects.reserve(n);
+        statuses.reserve(n);
+        methods.reserve(n);
+        patternIndices.reserve(n);
+    }
+
+    void AnnotationStore::clear() {
+        *this = AnnotationStore();
+    }
+
+    const std::vector<uint32_t>& AnnotationStore::byRecord(int recordID) const {
+        static const std::vector<uint32_t> none;
+        auto found = recordRows.find(recordID);
+        return found == recordRows.end() ? none : found->second;
+    }
+
+    const std::vector<uint32_t>& AnnotationStore::byConstruction(CausalConstructicon::ConstructionHandle id) const {
+        static const std::vector<uint32_t> none;
+        return id.valid() && id.value < constructionRows.size() ? constructionRows[id.value] : none;
+    }
+
+    std::vector<uint32_t> AnnotationStore::select(CausalConstructicon::ConstructionHandle id, AnnotationStatus status) const {
+        // the construction index narrows the rows, then only the status column is read
+        std::vector<uint32_t> rows;
+        for (uint32_t row : byConstruction(id)) {
+            if (statuses[row] == status) rows.push_back(row);
+        }
+        return rows;
+    }
+
+    size_t AnnotationStore::count(AnnotationStatus status) const {
+        return static_cast<size_t>(std::count(statuses.begin(), statuses.end(), status));
+    }
+
+    std::vector<AnnotationStore::PatternDecisions> AnnotationStore::decisionsPerPattern(size_t patternCount) const {
+        // one pass over three columns, without assembling entries
+        std::vector<PatternDecisions> decisions(patternCount);
+        const size_t n = size();
+        for (size_t i = 0; i < n; i++) {
+            uint32_t pattern = patternIndices[i];
+            if (pattern >= patternCount) continue;
+            decisions[pattern].add(statuses[i], methods[i]);
+        }
+        return decisions;
+    }
 
-    std::vector<AnnotationEntry>& getAnnotations() {
+    AnnotationStore& getAnnotations() {
         return annotations;
         }
 
     void addAnnotationEntry(const AnnotationEntry& entry) { 
-        annotations.push_back(entry); 
+        annotations.add(entry); 
+        }
+
+    // SAX handler that builds records while cleaned_data.json is read, so no DOM of the whole file is kept
+    // expects an array of objects with an integer cm_mkey and a string cm_probableCause;
+    // objects without both fields or with the wrong types are skipped and counted
+    struct RecordSaxHandler : nlohmann::json_sax<json> {
+        std::vector<Record>& out;
+        size_t skipped;
+        std::string error;
+
+        // the mapped file being parsed, and where the search for the next statement starts
+        std::string_view source;
+        size_t cursor;
+
+        // nesting depth: 1 inside the top level array, 2 inside a record object
+        int depth;
+        std::string currentKey;
+        bool hasID;
+        bool hasCause;
+        bool malformed;
+        int recordID;
+        std::string_view probableCause;
+
+        // decoded statements are kept here
+        RecordStore& store;
+
+        RecordSaxHandler(std::vector<Record>& records, RecordStore& recordStore) :
+        out(records), skipped(0), source(recordStore.file.view()), cursor(0), depth(0), hasID(false), hasCause(false), malformed(false), recordID(0), store(recordStore) {}
+
+        // view of a statement in the mapped file instead of a copy
+        // the SAX interface gives no positions, so the decoded string is searched forward from the previous
+        // statement; strings without escapes are stored verbatim, and any identical bytes are an equally good view
+        // strings with escapes are not found within the window and are kept decoded in the record store
+        std::string_view locate(std::string& value) {
+            size_t window = std::min(source.size() - cursor, value.size() * 6 + 65536);
+            size_t found = source.substr(cursor, window).find(value);
+            if (found == std::string_view::npos) {
+                return store.keep(std::move(value));
+            }
+            cursor += found + value.size();
+            return source.substr(cursor - value.size(), value.size());
+        }
+
+        // values directly inside a record object
+        bool atField() const { return depth == 2; }
+
+        // a field of the wrong type makes the record malformed if it is one of ours
+        bool other() {
+            if (atField() && (currentKey == "cm_mkey" || currentKey == "cm_probableCause")) malformed = true;
+            if (depth < 2) skipped++;
+            return true;
+        }
+
+        bool null() override { return other(); }
+        bool boolean(bool) override { return other(); }
+        bool number_float(number_float_t, const string_t&) override { return other(); }
+        bool binary(binary_t&) override { return other(); }
+
+        bool number_integer(number_integer_t value) override {
+            if (!atField() || currentKey != "cm_mkey") return other();
+            recordID = static_cast<int>(value);
+            hasID = true;
+            return true;
+        }
+
+        bool number_unsigned(number_unsigned_t value) override {
+            return number_integer(static_cast<number_integer_t>(value));
+        }
+
+        bool string(string_t& value) override {
+            if (!atField() || currentKey != "cm_probableCause") return other();
+            probableCause = locate(value);
+            hasCause = true;
+            return true;
+        }
+
+        bool key(string_t& value) override {
+            if (atField()) currentKey = value;
+            return true;
+        }
+
+        bool start_object(std::size_t) override {
+            if (atField()) other();
+            depth++;
+            if (depth == 2) {
+                hasID = hasCause = malformed = false;
+                probableCause = std::string_view();
+            }
+            return true;
+        }
+
+        bool end_object() override {
+            if (depth == 2) {
+                if (hasID && hasCause && !malformed) {
+                    out.emplace_back(recordID, probableCause);
+                } else {
+                    skipped++;
+                }
+            }
+            depth--;
+            return true;
+        }
+
+        bool start_array(std::size_t) override {
+            if (atField()) other();
+            else if (depth == 1) skipped++;
+            depth++;
+            return true;
+        }
+
+        bool end_array() override {
+            depth--;
+            return true;
+        }
+
+        bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex) override {
+            error = "byte " + std::to_string(position) + ": " + ex.what();
+            return false;
+        }
+    };
+
+    bool loadRecordsFromJSON(const std::string& path, RecordStore& store, std::vector<Record>& out) {
+        store.file = MappedFile(path);
+        if (!store.file.isOpen()) {
+            std::cerr << "Failed to load records from " << path << std::endl;
+            return false;
+        }
+
+        // parse the mapped file with the SAX handler; records are views into the mapping
+        size_t before = out.size();
+        RecordSaxHandler handler(out, store);
+        const char* begin = store.file.data();
+        bool complete = json::sax_parse(begin, begin + store.file.size(), &handler);
+        if (!complete) {
+            std::cerr << "Failed to parse " << path << " after " << (out.size() - before)
+                      << " records (" << handler.error << ")" << std::endl;
+        }
+        if (handler.skipped > 0) {
+            std::cerr << "Skipped " << handler.skipped << " malformed entries in " << path << std::endl;
+        }
+        return complete;
+    }
+
+    // helper: header of a mapped corpus file, or nullptr if the file is not a valid corpus of this version
+    static const CorpusHeader* corpusHeader(const MappedFile& file) {
+        if (file.size() < sizeof(CorpusHeader)) return nullptr;
+        const auto* header = reinterpret_cast<const CorpusHeader*>(file.data());
+        if (std::memcmp(header->magic, CorpusMagic, sizeof(CorpusMagic)) != 0 || header->version != CorpusVersion) return nullptr;
+
+        // sections follow the header in order and are 8-byte aligned, as writeCorpus lays them out, so the columns
+        // can be read in place; each field is checked against the file size before anything is added to it
+        uint64_t end = sizeof(CorpusHeader);
+        auto section = [&file, &end](uint64_t offset, uint64_t count, uint64_t size) {
+            if (offset < end || offset % 8 != 0 || offset > file.size() || count > (file.size() - offset) / size) return false;
+            end = offset + count * size;
+            return true;
+        };
+        uint64_t count = header->recordCount;
+        if (!section(header->idsOffset, count, sizeof(int32_t))
+            || !section(header->textOffsetsOffset, count + 1, sizeof(uint64_t))
+            || !section(header->textOffset, header->textSize, 1)) {
+            return nullptr;
+        }
+        return header;
+    }
+
+    bool loadRecordsFromCorpus(const std::string& path, RecordStore& store, std::vector<Record>& out) {
+        store.file = MappedFile(path);
+        const CorpusHeader* header = corpusHeader(store.file);
+        if (!header) {
+            std::cerr << "Failed to load records from " << path << " (not a version " << CorpusVersion << " corpus)" << std::endl;
+            return false;
+        }
+
+        // the columns are used in place; records only point into the text blob
+        const char* base = store.file.data();
+        const auto* ids = reinterpret_cast<const int32_t*>(base + header->idsOffset);
+        const auto* offsets = reinterpret_cast<const uint64_t*>(base + header->textOffsetsOffset);
+        const char* text = base + header->textOffset;
+
+        out.reserve(out.size() + header->recordCount);
+        for (uint32_t i = 0; i < header->recordCount; i++) {
+            if (offsets[i] > offsets[i + 1] || offsets[i + 1] > header->textSize) {
+                std::cerr << "Corrupt text offsets in " << path << " at record " << i << std::endl;
+                return false;
+            }
+            out.emplace_back(ids[i], std::string_view(text + offsets[i], offsets[i + 1] - offsets[i]));
+        }
+        return true;
+    }
+
+    bool writeCorpus(const std::string& path, const std::vector<Record>& records) {
+        // helper: pad the output to the next multiple of 8 bytes
+        auto align = [](uint64_t offset) { return (offset + 7) & ~static_cast<uint64_t>(7); };
+
+        CorpusHeader header;
+        std::memcpy(header.magic, CorpusMagic, sizeof(CorpusMagic));
+        header.version = CorpusVersion;
+        header.recordCount = static_cast<uint32_t>(records.size());
+        header.idsOffset = align(sizeof(CorpusHeader));
+        header.textOffsetsOffset = align(header.idsOffset + records.size() * sizeof(int32_t));
+        header.textOffset = align(header.textOffsetsOffset + (records.size() + 1) * sizeof(uint64_t));
+        header.textSize = 0;
+
+        std::vector<int32_t> ids;
+        std::vector<uint64_t> offsets;
+        ids.reserve(records.size());
+        offsets.reserve(records.size() + 1);
+        for (const auto& record : records) {
+            ids.push_back(record.recordID);
+            offsets.push_back(header.textSize);
+            header.textSize += record.probableCause.size();
+        }
+        offsets.push_back(header.textSize);
+
+        // write to a temporary file and rename it, so readers never map a half-written corpus
+        std::string temporary = path + ".tmp";
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+
+        const char zeros[8] = {};
+        auto pad = [&file, &zeros](uint64_t to) {
+            uint64_t at = static_cast<uint64_t>(file.tellp());
+            if (to > at) file.write(zeros, static_cast<std::streamsize>(to - at));
+        };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        pad(header.idsOffset);
+        file.write(reinterpret_cast<const char*>(ids.data()), static_cast<std::streamsize>(ids.size() * sizeof(int32_t)));
+        pad(header.textOffsetsOffset);
+        file.write(reinterpret_cast<const char*>(offsets.data()), static_cast<std::streamsize>(offsets.size() * sizeof(uint64_t)));
+        pad(header.textOffset);
+        for (const auto& record : records) {
+            file.write(record.probableCause.data(), static_cast<std::streamsize>(record.probableCause.size()));
+        }
+        file.close();
+
+        if (!file || std::rename(temporary.c_str(), path.c_str()) != 0) {
+            std::remove(temporary.c_str());
+            return false;
         }
+        return true;
+    }
+
+    size_t corpusRecordCount(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        CorpusHeader header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) return 0;
+        if (std::memcmp(header.magic, CorpusMagic, sizeof(CorpusMagic)) != 0 || header.version != CorpusVersion) return 0;
+        return header.recordCount;
+    }
+
+    // helper: modification time of a file, or 0 if it does not exist
+    static time_t modificationTime(const std::string& path) {
+        struct stat info;
+        return ::stat(path.c_str(), &info) == 0 ? info.st_mtime : 0;
+    }
 
     struct AnnotatorInitializer {
         AnnotatorInitializer() {
             std::cout << "Loading NTSB accident records..." << std::endl;
-            
-            try {
-                std::ifstream file("cleaned_data.json");
-                json data = json::parse(file);
-                
-                records.reserve(data.size());
-                
-                for (const auto& item : data) {
-                    records.emplace_back(
-                        item["cm_mkey"].get<int>(),
-                        item["cm_probableCause"].get<std::string>()
-                    );
-                }
-                
-                std::cout << "Annotator initialized: " 
-                          << records.size() << " records" << std::endl;
-                          
-            } catch (...) {
-                std::cerr << "Failed to load records from cleaned_data.json" << std::endl;
+
+            // prefer the binary corpus written by corpus_converter, unless the JSON was changed after it
+            time_t binaryTime = modificationTime("cleaned_data.bin");
+            time_t jsonTime = modificationTime("cleaned_data.json");
+            std::string source = "cleaned_data.bin";
+            if (binaryTime == 0 || binaryTime < jsonTime || !loadRecordsFromCorpus(source, recordStore, records)) {
+                if (binaryTime != 0 && binaryTime < jsonTime) {
+                    std::cerr << "cleaned_data.bin is older than cleaned_data.json; run corpus_converter to update it" << std::endl;
+                }
+                source = "cleaned_data.json";
+                records.clear();
+                loadRecordsFromJSON(source, recordStore, records);
             }
+
+            // sentences, clauses, and tokens of every record, for the matcher, span suggestions, and display
+            segmentIndex.build(records);
+
+            // reload earlier sessions, including rows a session that did not end normally left in the log
+            // they are on disk already, so saveAnnotations starts after them
+            loadAnnotations("annotations.csv", annotations);
+            if (modificationTime(annotationLog.path()) != 0) {
+                loadAnnotations(annotationLog.path(), annotations, true);
+            }
+            annotationLog.saved = annotations.size();
+
+            // per-pattern decisions of earlier sessions, for precision statistics
+            long decisions = loadDecisions(decisionLog.path(), CausalConstructicon::getPatterns(), patternDecisions);
+            
+            std::cout << "Annotator initialized: " 
+                      << records.size() << " records (" << source << "), "
+                      << annotations.size() << " saved annotations, "
+                      << std::max(decisions, 0L) << " pattern decisions" << std::endl;
         }
     };
     
@@ -113,10 +2270,10 @@ namespace Annotator {
     
     // save the current index for progress tracking 
     void saveCurrentIndex(size_t index) {
-        std::ofstream file("progress.txt");
-        if (file.is_open()) {
-            file << index;
-            file.close();
+        if (persistenceWriter.running()) {
+            persistenceWriter.submitProgress(index);
+        } else {
+            writeProgressFile("progress.txt", index);
         }
     }
 
@@ -141,12 +2298,22 @@ namespace Annotator {
         
         std::cout << "\nStarting annotation process\n" << std::endl;
      
+        // fold any log left by an earlier session that did not end normally into annotations.csv
+        compactAnnotations();
+        persistenceWriter.start();
+
         // load last saved index
         size_t startIndex = loadLastIndex();
         if (startIndex > 0) {
             std::cout << "Resuming from record " << (startIndex + 1) << std::endl;
         }
 
+        // a session that added patterns loads their matcher from the cache next time
+        CausalConstructicon::setMatcherCachePath("pattern_matcher.bin");
+
+        // match the following records while the current one is reviewed
+        recordPrefetcher.start(startIndex);
+
         for (size_t i = startIndex; i < records.size(); i++) {
 
             // process one record
@@ -163,6 +2330,9 @@ namespace Annotator {
 
                 // save current index to track progress
                 saveCurrentIndex(i + 1);
+                recordPrefetcher.stop();
+                persistenceWriter.stop();
+                compactAnnotations();
                 std::cout << "\nEnd of session. All annotation entries saved to annotations.csv." << std::endl;
                 return;
             }
@@ -174,6 +2344,9 @@ namespace Annotator {
         // if we get here, all records were processed
         std::cout << "\nAll records processed!" << std::endl;
         saveAnnotations();
+        recordPrefetcher.stop();
+        persistenceWriter.stop();
+        compactAnnotations();
         }
     
     // process one record
@@ -193,8 +2366,8 @@ namespace Annotator {
         // track if any automatic processing was done
         bool automaticProcessingDone = false;
 
-        // automatic processing: find all pattern matches in record
-        auto matches = findPatternMatches(*currentRecord);  
+        // automatic processing: find all pattern matches in record, prepared ahead by the prefetcher
+        auto matches = findPatternMatches(*currentRecord, recordPrefetcher.take(recordIndex));  
         
         automaticProcessingDone = true;
         
@@ -205,134 +2378,476 @@ namespace Annotator {
     }
     
     // helper: get text span from user for cause and effect
-    std::string getTextSpan(const std::string& prompt, const std::string& fullText) {
+    // the pasted text is located in the record, so only its offsets are kept
+    TextSpan getTextSpan(const std::string& prompt, std::string_view fullText) {
         std::string span;
         std::cout << prompt;
         std::getline(std::cin, span);
-        return span;
+        return locateSpan(fullText, span);
+    }
+
+    // helper: index of a record in records, for records passed by reference
+    static uint32_t recordIndexOf(const Record& record) {
+        if (!records.empty() && &record >= records.data() && &record < records.data() + records.size()) {
+            return static_cast<uint32_t>(&record - records.data());
+        }
+        return findRecordIndex(record.recordID);
+    }
+
+    void SegmentIndex::build(const std::vector<Record>& records) {
+        all = CausalConstructicon::TextSegments();
+        wordBegin.assign(1, 0);
+        tokenBegin.assign(1, 0);
+        clauseBegin.assign(1, 0);
+        sentenceBegin.assign(1, 0);
+        wordBegin.reserve(records.size() + 1);
+        tokenBegin.reserve(records.size() + 1);
+        clauseBegin.reserve(records.size() + 1);
+        sentenceBegin.reserve(records.size() + 1);
+
+        for (const auto& record : records) {
+            // words are interned, so the matcher compares word IDs only
+            CausalConstructicon::segmentText(record.probableCause, all, true);
+            wordBegin.push_back(static_cast<uint32_t>(all.words.size()));
+            tokenBegin.push_back(static_cast<uint32_t>(all.tokens.size()));
+            clauseBegin.push_back(static_cast<uint32_t>(all.clauses.size()));
+            sentenceBegin.push_back(static_cast<uint32_t>(all.sentences.size()));
+        }
+    }
+
+    CausalConstructicon::SegmentView SegmentIndex::operator[](size_t recordIndex) const {
+        CausalConstructicon::SegmentView view;
+        view.tokens = all.tokens.data() + tokenBegin[recordIndex];
+        view.tokenCount = tokenBegin[recordIndex + 1] - tokenBegin[recordIndex];
+        view.clauses = all.clauses.data() + clauseBegin[recordIndex];
+        view.clauseCount = clauseBegin[recordIndex + 1] - clauseBegin[recordIndex];
+        view.sentences = all.sentences.data() + sentenceBegin[recordIndex];
+        view.sentenceCount = sentenceBegin[recordIndex + 1] - sentenceBegin[recordIndex];
+        view.words = all.words.data() + wordBegin[recordIndex];
+        view.wordIDs = all.wordIDs.data() + wordBegin[recordIndex];
+        view.spaceBefore = all.spaceBefore.data() + wordBegin[recordIndex];
+        view.wordCount = wordBegin[recordIndex + 1] - wordBegin[recordIndex];
+        return view;
+    }
+
+    CausalConstructicon::SegmentView recordSegments(const Record& record, CausalConstructicon::TextSegments& scratch) {
+        uint32_t recordIndex = recordIndexOf(record);
+        if (recordIndex != NoRecord && recordIndex < segmentIndex.size()
+            && records[recordIndex].probableCause.data() == record.probableCause.data()) {
+            return segmentIndex[recordIndex];
+        }
+        CausalConstructicon::segmentText(record.probableCause, scratch);
+        return CausalConstructicon::SegmentView(scratch);
     }
     
     // helper: display full record with simple formatting
-    // TODO: add text wrapping
+    // lines are wrapped between tokens at 100 columns
     void displayRecord(const Record& record) {
+        const size_t width = 100;
+        std::string_view text = record.probableCause;
+        CausalConstructicon::TextSegments scratch;
+        CausalConstructicon::SegmentView segments = recordSegments(record, scratch);
+
         std::cout << "Accident report: " << std::endl;
-        std::cout << record.probableCause << std::endl;
+        auto space = [&text](size_t i) { return CausalConstructicon::isSpaceByte(static_cast<unsigned char>(text[i])); };
+        size_t lineStart = 0;
+        size_t lineEnd = 0;
+        for (size_t t = 0; t < segments.tokenCount; t++) {
+            // the token with the punctuation around it
+            size_t runEnd = segments.tokens[t].end;
+            while (runEnd < text.size() && !space(runEnd)) runEnd++;
+            if (runEnd - lineStart > width && lineEnd > lineStart) {
+                std::cout << text.substr(lineStart, lineEnd - lineStart) << std::endl;
+                lineStart = lineEnd;
+                while (lineStart < text.size() && space(lineStart)) lineStart++;
+            }
+            lineEnd = runEnd;
+        }
+        std::cout << text.substr(lineStart) << std::endl;
+    }
+
+    // helper: display text with highlighted trigger based on status
+    // the trigger is given by its offsets, so repeated triggers are highlighted at the right occurrence
+    void displayTextWithHighlight(size_t start, size_t end, AnnotationStatus status) {
+        if (!currentRecord) return;
+    
+        std::string_view text = currentRecord->probableCause;
+        if (start > end || end > text.size()) return;
+
+        std::cout << renderHighlight(text, start, end, status) << std::endl;
+    }
+
+    std::string renderHighlight(std::string_view text, size_t start, size_t end, AnnotationStatus status) {
+        if (start > end || end > text.size()) return std::string(text);
+        
+        // choose color based on status
+        // these are ANSI escape codes
+        std::string_view color;
+        switch(status) {
+            case AnnotationStatus::Candidate:
+                color = "\033[33m"; // yellow
+                break;
+            case AnnotationStatus::Verified:
+                color = "\033[32m"; // green
+                break;
+            case AnnotationStatus::Rejected:
+                color = "\033[31m"; // red
+                break;
+            default:
+                color = "\033[0m"; // reset
+                break;
+        }
+
+        std::string rendered;
+        rendered.reserve(text.size() + color.size() + 4);
+        rendered.append(text.substr(0, start)).append(color).append(text.substr(start, end - start))
+            .append("\033[0m").append(text.substr(end));
+        return rendered;
+    }
+
+    PreparedRecord prepareRecord(const Record& record) {
+        PreparedRecord prepared;
+        prepared.recordIndex = recordIndexOf(record);
+
+        // one scan of the record for all patterns, then one candidate per trigger region
+        CausalConstructicon::TextSegments scratch;
+        CausalConstructicon::SegmentView segments = recordSegments(record, scratch);
+        const auto& matcher = CausalConstructicon::getMatcher();
+        prepared.hits = matcher.resolveOverlaps(matcher.match(record.probableCause, nullptr, &segments));
+
+        prepared.highlights.reserve(prepared.hits.size());
+        for (const auto& hit : prepared.hits) {
+            prepared.highlights.push_back(renderHighlight(record.probableCause, hit.start, hit.end, AnnotationStatus::Candidate));
+        }
+        return prepared;
+    }
+
+    RecordPrefetcher::RecordPrefetcher(size_t d) : depth(d == 0 ? 1 : d), stopping(false), finished(false) {}
+
+    RecordPrefetcher::~RecordPrefetcher() {
+        stop();
+    }
+
+    void RecordPrefetcher::start(size_t firstRecord) {
+        stop();
+
+        // compile the matcher here, so the worker only reads it
+        CausalConstructicon::getMatcher();
+
+        ready.clear();
+        stopping = false;
+        finished = false;
+        worker = std::thread(&RecordPrefetcher::run, this, firstRecord);
+    }
+
+    void RecordPrefetcher::stop() {
+        if (!running()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        space.notify_all();
+        worker.join();
+        ready.clear();
+    }
+
+    void RecordPrefetcher::run(size_t firstRecord) {
+        for (size_t i = firstRecord; i < records.size(); i++) {
+            // the matching itself runs without the lock
+            PreparedRecord prepared = prepareRecord(records[i]);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            space.wait(lock, [this]() { return stopping || ready.size() < depth; });
+            if (stopping) return;
+            ready.push_back(std::move(prepared));
+            available.notify_one();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+        available.notify_all();
+    }
+
+    PreparedRecord RecordPrefetcher::take(size_t recordIndex) {
+        if (running()) {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                // records the annotator skipped are dropped
+                while (!ready.empty() && ready.front().recordIndex < recordIndex) {
+                    ready.pop_front();
+                    space.notify_one();
+                }
+                if (!ready.empty()) {
+                    if (ready.front().recordIndex != recordIndex) break;
+                    PreparedRecord prepared = std::move(ready.front());
+                    ready.pop_front();
+                    space.notify_one();
+                    return prepared;
+                }
+                if (finished || stopping) break;
+                available.wait(lock);
+            }
+        }
+        return recordIndex < records.size() ? prepareRecord(records[recordIndex]) : PreparedRecord();
     }
 
-    // helper: display text with highlighted trigger based on status
-    void displayTextWithHighlight(const std::string& trigger, AnnotationStatus status) {
-        if (!currentRecord) return;
-    
-        std::string text = currentRecord->probableCause;
-        size_t pos = text.find(trigger);
-        if (pos == std::string::npos) return;
-        
-        // choose color based on status
-        // these are ANSI escape codes
-        std::string color;
-        switch(status) {
-            case AnnotationStatus::Candidate:
-                color = "\033[33m"; // yellow
-                break;
-            case AnnotationStatus::Verified:
-                color = "\033[32m"; // green
-                break;
-            case AnnotationStatus::Rejected:
-                color = "\033[31m"; // red
-                break;
-            default:
-                color = "\033[0m"; // reset
-                break;
+    void heuristicSpans(const std::string& description, std::string_view text, size_t start, size_t end,
+        TextSpan& cause, TextSpan& effect) {
+        CausalConstructicon::TextSegments segments;
+        CausalConstructicon::segmentText(text, segments);
+        heuristicSpans(description, text, CausalConstructicon::SegmentView(segments), start, end, cause, effect);
+    }
+
+    void heuristicSpans(const std::string& description, std::string_view text, const CausalConstructicon::SegmentView& segments,
+        size_t start, size_t end, TextSpan& cause, TextSpan& effect) {
+        // clauses around the trigger, without the punctuation that ends the sentence
+        size_t clauseStart = 0;
+        size_t clauseEnd = text.size();
+        if (segments.clauseCount > 0) {
+            clauseStart = std::min<size_t>(segments.clauses[segments.clauseAt(start)].start, start);
+            clauseEnd = std::max<size_t>(segments.clauses[segments.clauseAt(end > start ? end - 1 : end)].end, end);
+        }
+        if (clauseEnd > end && (text[clauseEnd - 1] == '.' || text[clauseEnd - 1] == '!' || text[clauseEnd - 1] == '?')) clauseEnd--;
+
+        auto trimmed = [&text](size_t b, size_t e) {
+            while (b < e && (text[b] == ' ' || text[b] == ',')) b++;
+            while (e > b && (text[e - 1] == ' ' || text[e - 1] == ',')) e--;
+            return TextSpan(static_cast<uint32_t>(b), static_cast<uint32_t>(e));
+        };
+        TextSpan left = trimmed(clauseStart, start);
+        TextSpan right = trimmed(end, clauseEnd);
+
+        // position of the trigger in the description: its first word outside of a slot,
+        // skipping placeholders like NP and DET
+        size_t trigger = description.size();
+        for (size_t i = 0; i < description.size() && trigger == description.size(); i++) {
+            if (description[i] == '<') {
+                i = description.find('>', i);
+                if (i == std::string::npos) break;
+                continue;
+            }
+            if (!std::isalpha(static_cast<unsigned char>(description[i]))) continue;
+            size_t wordEnd = i;
+            bool placeholder = true;
+            while (wordEnd < description.size() && std::isalpha(static_cast<unsigned char>(description[wordEnd]))) {
+                placeholder = placeholder && std::isupper(static_cast<unsigned char>(description[wordEnd]));
+                wordEnd++;
+            }
+            if (placeholder && wordEnd - i > 1) {
+                i = wordEnd;
+                continue;
+            }
+            trigger = i;
+        }
+
+        size_t causeSlot = description.find("cause>");
+        size_t effectSlot = description.find("<effect");
+        bool causeBefore = causeSlot < trigger;
+        bool effectBefore = effectSlot < trigger;
+
+        // split a side at its first "was", "is", "were", or "are"
+        auto splitAtCopula = [&](const TextSpan& side, TextSpan& first, TextSpan& second) {
+            std::string_view rest = text.substr(side.start, side.end - side.start);
+            size_t split = std::string_view::npos;
+            size_t length = 0;
+            for (std::string_view copula : {" was ", " is ", " were ", " are "}) {
+                size_t at = rest.find(copula);
+                if (at < split) {
+                    split = at;
+                    length = copula.size();
+                }
+            }
+            if (split == std::string_view::npos) return false;
+            first = trimmed(side.start, side.start + split);
+            second = trimmed(side.start + split + length, side.end);
+            return true;
+        };
+        TextSpan first;
+        TextSpan second;
+
+        if (causeBefore != effectBefore) {
+            // fronted trigger, e.g. "Further contributing to the accident was ...": the slot that
+            // would precede the trigger follows the copula instead
+            bool fronted = std::count(text.begin() + left.start, text.begin() + left.end, ' ') == 0;
+            if (fronted && splitAtCopula(right, first, second)) {
+                cause = causeBefore ? second : first;
+                effect = causeBefore ? first : second;
+                return;
+            }
+            cause = causeBefore ? left : right;
+            effect = causeBefore ? right : left;
+            return;
         }
-        
-        std::cout << text.substr(0, pos)
-                << color << trigger << "\033[0m"
-                << text.substr(pos + trigger.length()) << std::endl;
+
+        // both slots follow the trigger: split the rest of the sentence at its copula
+        if (!causeBefore && splitAtCopula(right, first, second)) {
+            cause = causeSlot < effectSlot ? first : second;
+            effect = causeSlot < effectSlot ? second : first;
+            return;
+        }
+
+        // both slots on the same side and nothing to split on: the whole side is the first slot
+        TextSpan side = causeBefore ? left : right;
+        cause = causeSlot < effectSlot ? side : TextSpan();
+        effect = causeSlot < effectSlot ? TextSpan() : side;
     }
 
     // automatic processing: find pattern matches in record 
-    // TODO: search for longest matches first, then substrings, e.g. "the probable cause of" then "cause"
+    // overlapping matches are resolved longest (highest priority) first, e.g. "the probable cause of" over "cause"
     std::vector<AnnotationEntry> findPatternMatches(const Record& record) {
+        return findPatternMatches(record, prepareRecord(record));
+    }
+
+    std::vector<AnnotationEntry> findPatternMatches(const Record& record, const PreparedRecord& prepared) {
     std::vector<AnnotationEntry> matches;
     const auto& patterns = CausalConstructicon::getPatterns();
-    
-    for (const auto& pattern : patterns) {
-        std::string text = record.probableCause;
-        std::smatch regexMatch;
+    std::string_view text = record.probableCause;
+
+    const auto& hits = prepared.hits;
+    uint32_t recordIndex = recordIndexOf(record);
+    CausalConstructicon::TextSegments scratch;
+    CausalConstructicon::SegmentView segments = recordSegments(record, scratch);
+
+    // helper: a span of the record, or a pooled copy if the record is not in records
+    auto recordSpan = [&](const TextSpan& span) {
+        return recordIndex != NoRecord ? span : spanPool.keep(text.substr(span.start, span.end - span.start));
+    };
+
+    // FullAuto hits first: verified in bulk, without prompts
+    size_t autoVerified = 0;
+    for (const auto& hit : hits) {
+        const auto& pattern = patterns[hit.patternIndex];
+        if (pattern.parse_method != ParseMethod::FullAuto) continue;
+
+        if (autoVerified++ == 0) {
+            std::cout << "\n~~~ Automatic Verification Phase ~~~" << std::endl;
+        }
+
+        AnnotationEntry entry;
+        entry.constructionID = pattern.ids.empty() ? CausalConstructicon::ConstructionHandle() : pattern.ids[0];
+        entry.recordID = record.recordID;
+        entry.recordIndex = recordIndex;
+        entry.status = AnnotationStatus::Verified;
+        entry.parse_method = ParseMethod::FullAuto;
+        entry.patternIndex = static_cast<uint32_t>(hit.patternIndex);
+        entry.trigger = recordSpan(TextSpan(static_cast<uint32_t>(hit.start), static_cast<uint32_t>(hit.end)));
+
+        TextSpan cause;
+        TextSpan effect;
+        heuristicSpans(pattern.description, text, segments, hit.start, hit.end, cause, effect);
+        entry.cause = recordSpan(cause);
+        entry.effect = recordSpan(effect);
+
+        addAnnotationEntry(entry);
+        matches.push_back(entry);
+
+        std::cout << "\nMatching pattern: " << pattern.description << " (FullAuto)" << std::endl;
+        displayTextWithHighlight(hit.start, hit.end, entry.status);
+        std::cout << "Cause: " << entry.causeText() << std::endl;
+        std::cout << "Effect: " << entry.effectText() << std::endl;
+    }
+    if (autoVerified > 0) {
+        std::cout << "\n" << autoVerified << " causal connector(s) verified automatically." << std::endl;
+    }
+
+    // review every other hit, in text order
+    for (size_t h = 0; h < hits.size(); h++) {
+        const auto& hit = hits[h];
+        const auto& pattern = patterns[hit.patternIndex];
+        if (pattern.parse_method == ParseMethod::FullAuto) continue;
+        
+        // found a match
+        std::string_view trigger = text.substr(hit.start, hit.end - hit.start);
+        TextSpan triggerSpan = recordIndex == NoRecord ? spanPool.keep(trigger)
+            : TextSpan(static_cast<uint32_t>(hit.start), static_cast<uint32_t>(hit.end));
+        
+        std::cout << "\n~~~ Automatic Matching Phase ~~~" << std::endl;
+        std::cout << "\nMatching pattern: " << pattern.description << std::endl;
+        std::cout << "Causal connector: \"" << trigger << "\"" << std::endl;
+        
+        // show candidate in yellow
+        std::cout << "\nFull record (candidate trigger highlighted):" << std::endl;
+        std::cout << prepared.highlights[h] << std::endl;
         
-        // search for pattern
-        if (std::regex_search(text, regexMatch, pattern.pattern)) {
-            // found a match
-            std::string trigger = regexMatch.str();
+        // ask user if valid
+        std::cout << "\nIs this a valid causal connector? (y/n, s to skip and leave it undecided): ";
+        std::string response;
+        std::getline(std::cin, response);
+                   
+        if (response == "s" || response == "skip" || response == "S") {
+            // user skipped: the hit stays a Candidate, which is logged as a decision so the pattern's
+            // undecided hits are counted, but not saved as an annotation
+            AnnotationEntry skipped;
+            skipped.constructionID = pattern.ids.empty() ? CausalConstructicon::ConstructionHandle() : pattern.ids[0];
+            skipped.recordID = record.recordID;
+            skipped.recordIndex = recordIndex;
+            skipped.trigger = triggerSpan;
+            skipped.status = AnnotationStatus::Candidate;
+            skipped.parse_method = pattern.parse_method;
+            skipped.patternIndex = static_cast<uint32_t>(hit.patternIndex);
+            addAnnotationEntry(skipped);
+
+            std::cout << "\nCausal connector left undecided." << std::endl;
+        } else if (response == "y" || response == "yes" || response == "Y") {
+            // user said yes: set status to Verified, and show text in green
+            // TODO: the text should remain green or red as long as the same record is in focus
+            std::cout << "\nVerified:" << std::endl;
             
-            std::cout << "\n~~~ Automatic Matching Phase ~~~" << std::endl;
-            std::cout << "\nMatching pattern: " << pattern.description << std::endl;
-            std::cout << "Causal connector: \"" << trigger << "\"" << std::endl;
+            // create annotation entry
+            AnnotationEntry entry;
             
-            // show candidate in yellow
-            std::cout << "\nFull record (candidate trigger highlighted):" << std::endl;
-            displayTextWithHighlight(trigger, AnnotationStatus::Candidate);
+            // a trigger may evoke multiple construction IDs, but for now we assume the ID in the first index of ids
+            // TODO: if multiple constructions are evoked, prompt the user to select the right one
+            entry.constructionID = pattern.ids.empty() ? CausalConstructicon::ConstructionHandle() : pattern.ids[0];
+            entry.recordID = record.recordID;
+            entry.recordIndex = recordIndex;
+            entry.trigger = triggerSpan;
+            entry.status = AnnotationStatus::Verified;
+            entry.parse_method = pattern.parse_method;
+            entry.patternIndex = static_cast<uint32_t>(hit.patternIndex);
+
+            displayTextWithHighlight(hit.start, hit.end, entry.status);
+            std::cout << "\nCausal connector verified." << std::endl;
+
+            // get cause and effect spans from user
+            std::cout << "\nPlease identify the CAUSE span (copy/paste from text):" << std::endl;
+            entry.cause = getTextSpan("Cause: ", text);
             
-            // ask user if valid
-            std::cout << "\nIs this a valid causal connector? (y/n): ";
-            std::string response;
-            std::getline(std::cin, response);
-                       
-            if (response == "y" || response == "yes" || response == "Y") {
-                // user said yes: set status to Verified, and show text in green
-                // TODO: the text should remain green or red as long as the same record is in focus
-                std::cout << "\nVerified:" << std::endl;
-                
-                // create annotation entry
-                AnnotationEntry entry;
-                
-                // a trigger may evoke multiple construction IDs, but for now we assume the ID in the first index of ids
-                // TODO: if multiple constructions are evoked, prompt the user to select the right one
-                entry.constructionID = pattern.ids.empty() ? "" : pattern.ids[0];
-                entry.recordID = record.recordID;
-                entry.trigger = trigger;
-                entry.status = AnnotationStatus::Verified;
-
-                displayTextWithHighlight(trigger, entry.status);
-                std::cout << "\nCausal connector verified." << std::endl;
-
-                // get cause and effect spans from user
-                std::cout << "\nPlease identify the CAUSE span (copy/paste from text):" << std::endl;
-                entry.cause = getTextSpan("Cause: ", text);
-                
-                std::cout << "\nPlease identify the EFFECT span (copy/paste from text):" << std::endl;
-                entry.effect = getTextSpan("Effect: ", text);
-
-                // add to annotations
-                addAnnotationEntry(entry);
-
-                // show saved confirmation
-                std::cout << "\nAnnotation saved." << std::endl;
-                std::cout << "Record ID: " << entry.recordID << std::endl;
-                std::cout << "Construction ID: " << entry.constructionID << std::endl;
-                std::cout << "Causal connector: " << entry.trigger << std::endl;
-                std::cout << "Cause: " << entry.cause << std::endl;       
-                std::cout << "Effect: " << entry.effect << std::endl;
-                
-                matches.push_back(entry);
+            std::cout << "\nPlease identify the EFFECT span (copy/paste from text):" << std::endl;
+            entry.effect = getTextSpan("Effect: ", text);
+
+            // add to annotations
+            addAnnotationEntry(entry);
+
+            // show saved confirmation
+            std::cout << "\nAnnotation saved." << std::endl;
+            std::cout << "Record ID: " << entry.recordID << std::endl;
+            std::cout << "Construction ID: " << entry.constructionID << std::endl;
+            std::cout << "Causal connector: " << entry.triggerText() << std::endl;
+            std::cout << "Cause: " << entry.causeText() << std::endl;       
+            std::cout << "Effect: " << entry.effectText() << std::endl;
             
-            // storing rejected entries can be useful for testing precision and recall
-            // as an option, rejected entries do not need to be stored
-            // TODO: when generating the graph, make sure to ignore rejected annotation entries
-            } else {
-                // user said no: set status to Rejected, and show text in red
-                std::cout << "\nRejected:" << std::endl;
-                
-                AnnotationEntry rejected;
-                rejected.constructionID = pattern.ids.empty() ? "" : pattern.ids[0];
-                rejected.recordID = record.recordID;
-                rejected.trigger = trigger;
-                rejected.status = AnnotationStatus::Rejected;
-                addAnnotationEntry(rejected);
+            matches.push_back(entry);
+        
+        // storing rejected entries can be useful for testing precision and recall
+        // as an option, rejected entries do not need to be stored
+        // TODO: when generating the graph, make sure to ignore rejected annotation entries
+        } else {
+            // user said no: set status to Rejected, and show text in red
+            std::cout << "\nRejected:" << std::endl;
+            
+            AnnotationEntry rejected;
+            rejected.constructionID = pattern.ids.empty() ? CausalConstructicon::ConstructionHandle() : pattern.ids[0];
+            rejected.recordID = record.recordID;
+            rejected.recordIndex = recordIndex;
+            rejected.trigger = triggerSpan;
+            rejected.status = AnnotationStatus::Rejected;
+            rejected.parse_method = pattern.parse_method;
+            rejected.patternIndex = static_cast<uint32_t>(hit.patternIndex);
+            addAnnotationEntry(rejected);
 
-                displayTextWithHighlight(trigger, rejected.status);
-                std::cout << "\nCausal connector rejected." << std::endl;
-            }
+            displayTextWithHighlight(hit.start, hit.end, rejected.status);
+            std::cout << "\nCausal connector rejected." << std::endl;
         }
     }
     
@@ -367,15 +2882,18 @@ namespace Annotator {
         // TODO: in postprocessing step, generate unique construction IDs for all manual entries (TK: "to come")
         entry.constructionID = "TK";  
         entry.recordID = record.recordID;
+        entry.recordIndex = recordIndexOf(record);
 
         // get the trigger, cause, and effect spans from the user
+        // the pasted trigger is located in the record (first occurrence)
         std::cout << "Please copy and paste the causal connector text here." << std::endl;
-        std::cout << "Causal connector: ";
-        std::getline(std::cin, entry.trigger);
+        entry.trigger = getTextSpan("Causal connector: ", record.probableCause);
 
         // show trigger in green
         std::cout << "\nVerified causal connector highlighted in green:" << std::endl;
-        displayTextWithHighlight(entry.trigger, entry.status);
+        if (!entry.trigger.pooled()) {
+            displayTextWithHighlight(entry.trigger.start, entry.trigger.end, entry.status);
+        }
 
         std::cout << "\nPlease identify the CAUSE span (copy/paste from text):" << std::endl;
         entry.cause = getTextSpan("Cause: ", record.probableCause);
@@ -414,9 +2932,9 @@ namespace Annotator {
         std::cout << "\nManual annotation saved." << std::endl;
         std::cout << "Record ID: " << entry.recordID << std::endl;
         std::cout << "Construction ID: " << entry.constructionID << std::endl;
-        std::cout << "Causal connector: " << entry.trigger << std::endl;
-        std::cout << "Cause: " << entry.cause << std::endl;       
-        std::cout << "Effect: " << entry.effect << std::endl;
+        std::cout << "Causal connector: " << entry.triggerText() << std::endl;
+        std::cout << "Cause: " << entry.causeText() << std::endl;       
+        std::cout << "Effect: " << entry.effectText() << std::endl;
         
         // recursive call to add another manual annotation
         manualEntry(record, automaticProcessingDone);         
@@ -432,33 +2950,668 @@ namespace Annotator {
         return (choice == "y" || choice == "yes" || choice == "Yes" || choice == "Y");
     }
 
+    // helper: csv row with the quoted text fields, in the column order of annotations.csv
+    // the span offsets come last, so readers that select columns by name are not affected
+    static const char* const AnnotationHeader =
+        "construction_id,record_id,trigger,cause,effect,status,trigger_start,trigger_end,cause_start,cause_end,effect_start,effect_end\n";
+
+    // offset columns of rows written before offsets were saved; their spans are located again on loading
+    static const char* const UnknownOffsets = ",,,,,";
+
+    // offsets is the text of the six offset columns
+    static std::string joinRow(std::string_view id, std::string_view recordID, std::string_view trigger,
+        std::string_view cause, std::string_view effect, std::string_view status, std::string_view offsets) {
+        std::string row;
+        row.reserve(id.size() + recordID.size() + trigger.size() + cause.size() + effect.size() + status.size() + offsets.size() + 16);
+        row.append(id).append(",").append(recordID).append(",");
+        row.append(csvField(trigger)).append(",").append(csvField(cause)).append(",").append(csvField(effect)).append(",");
+        row.append(status).append(",").append(offsets).append("\n");
+        return row;
+    }
+
+    // helper: offset columns of the fields of a row with or without them
+    static std::string rowOffsets(const std::vector<std::string_view>& fields) {
+        if (fields.size() != 12) return UnknownOffsets;
+        std::string offsets;
+        for (size_t i = 6; i < 12; i++) offsets.append(i > 6 ? "," : "").append(fields[i]);
+        return offsets;
+    }
+
+    std::string csvField(std::string_view text) {
+        std::string quoted = "\"";
+        for (char c : text) {
+            if (c == '"') quoted += '"';
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    void parseCSV(std::string_view text, const std::function<void(const std::vector<std::string_view>&)>& row) {
+        std::vector<std::string_view> fields;
+        std::deque<std::string> unescaped;
+        size_t i = 0;
+        const size_t n = text.size();
+
+        while (i < n) {
+            fields.clear();
+            unescaped.clear();
+
+            while (true) {
+                if (i < n && text[i] == '"') {
+                    // quoted field: ends at a quote followed by a delimiter or the end of the text
+                    size_t begin = ++i;
+                    size_t end = n;
+                    bool escaped = false;
+                    while (true) {
+                        size_t quote = text.find('"', i);
+                        if (quote == std::string_view::npos) {
+                            i = n;
+                            break;
+                        }
+                        if (quote + 1 < n && text[quote + 1] == '"') {
+                            escaped = true;
+                            i = quote + 2;
+                            continue;
+                        }
+                        if (quote + 1 == n || text[quote + 1] == ',' || text[quote + 1] == '\n' || text[quote + 1] == '\r') {
+                            end = quote;
+                            i = quote + 1;
+                            break;
+                        }
+                        i = quote + 1;
+                    }
+
+                    std::string_view field = text.substr(begin, end - begin);
+                    if (escaped) {
+                        std::string plain;
+                        plain.reserve(field.size());
+                        for (size_t k = 0; k < field.size(); k++) {
+                            plain += field[k];
+                            if (field[k] == '"' && k + 1 < field.size() && field[k + 1] == '"') k++;
+                        }
+                        unescaped.push_back(std::move(plain));
+                        field = unescaped.back();
+                    }
+                    fields.push_back(field);
+                } else {
+                    size_t end = text.find_first_of(",\r\n", i);
+                    if (end == std::string_view::npos) end = n;
+                    fields.push_back(text.substr(i, end - i));
+                    i = end;
+                }
+
+                if (i < n && text[i] == ',') {
+                    i++;
+                    continue;
+                }
+                break;
+            }
+
+            if (i < n && text[i] == '\r') i++;
+            if (i < n && text[i] == '\n') i++;
+
+            // blank lines are not rows
+            if (fields.size() > 1 || !fields[0].empty()) row(fields);
+        }
+    }
+
+    std::string annotationRow(const AnnotationEntry& entry) {
+        // the only place the span texts are materialized
+        // pooled spans have no offsets in the record
+        std::string offsets;
+        for (const TextSpan* span : {&entry.trigger, &entry.cause, &entry.effect}) {
+            if (!offsets.empty()) offsets += ",";
+            offsets += span->pooled() ? "," : std::to_string(span->start) + "," + std::to_string(span->end);
+        }
+        return joinRow(entry.constructionID.str(), std::to_string(entry.recordID), entry.triggerText(), entry.causeText(), entry.effectText(),
+            annotationStatusToString(entry.status), offsets);
+    }
+
+    // helper: append all pending bytes with one write, repeated only for the part a short write left over
+    // whatever could not be written stays pending
+    static bool writePending(int fd, std::string& pending) {
+        size_t written = 0;
+        while (written < pending.size()) {
+            ssize_t n = ::write(fd, pending.data() + written, pending.size() - written);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                pending.erase(0, written);
+                return false;
+            }
+            written += static_cast<size_t>(n);
+        }
+        pending.clear();
+        return true;
+    }
+
+    AnnotationLog::AnnotationLog(const std::string& path, size_t syncInterval) :
+    saved(0), logPath(path), interval(syncInterval == 0 ? 1 : syncInterval), unsynced(0), rows(0), fd(-1) {}
+
+    AnnotationLog::~AnnotationLog() {
+        close();
+    }
+
+    void AnnotationLog::append(const AnnotationEntry& entry) {
+        appendRow(annotationRow(entry));
+    }
+
+    void AnnotationLog::appendRow(std::string&& row) {
+        pending += row;
+        rows++;
+    }
+
+    bool AnnotationLog::commit() {
+        if (pending.empty()) return true;
+
+        if (fd < 0) {
+            fd = ::open(logPath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+            if (fd < 0) return false;
+
+            struct stat info;
+            if (::fstat(fd, &info) == 0 && info.st_size == 0) {
+                pending.insert(0, AnnotationHeader);
+            }
+        }
+
+        if (!writePending(fd, pending)) return false;
+
+        // the rows are in the page cache now; flush them to disk once per interval rather than per commit
+        if (++unsynced >= interval) {
+            ::fdatasync(fd);
+            unsynced = 0;
+        }
+        return true;
+    }
+
+    bool AnnotationLog::sync() {
+        bool ok = commit();
+        if (fd >= 0 && unsynced > 0) {
+            ok = ::fsync(fd) == 0 && ok;
+            unsynced = 0;
+        }
+        return ok;
+    }
+
+    void AnnotationLog::close() {
+        sync();
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    uint32_t patternKey(const CausalConstructicon::CausalPattern& pattern) {
+        // FNV-1a
+        // gapped patterns also hash their closing and gap
+        std::string text = pattern.source.empty() ? pattern.description : pattern.source;
+        if (pattern.gapped()) text += "\x1f" + std::to_string(pattern.maxGap) + "\x1f" + pattern.closing;
+        uint32_t hash = 2166136261u;
+        for (unsigned char c : text) {
+            hash = (hash ^ c) * 16777619u;
+        }
+        return hash;
+    }
+
+    DecisionRecord makeDecision(const AnnotationEntry& entry) {
+        const auto& patterns = CausalConstructicon::getPatterns();
+        DecisionRecord decision = {};
+        decision.recordID = entry.recordID;
+        decision.patternKey = entry.patternIndex < patterns.size() ? patternKey(patterns[entry.patternIndex]) : 0;
+        if (!entry.trigger.pooled()) {
+            decision.start = entry.trigger.start;
+            decision.length = static_cast<uint16_t>(std::min<uint32_t>(entry.trigger.end - entry.trigger.start, 0xFFFF));
+        }
+        decision.status = static_cast<uint8_t>(entry.status);
+        decision.method = static_cast<uint8_t>(entry.parse_method);
+        return decision;
+    }
+
+    DecisionLog::DecisionLog(const std::string& path, size_t syncInterval) :
+    logPath(path), interval(syncInterval == 0 ? 1 : syncInterval), unsynced(0), fd(-1) {}
+
+    DecisionLog::~DecisionLog() {
+        close();
+    }
+
+    void DecisionLog::append(const DecisionRecord& decision) {
+        pending.append(reinterpret_cast<const char*>(&decision), sizeof(decision));
+    }
+
+    bool DecisionLog::commit() {
+        if (pending.empty()) return true;
+
+        if (fd < 0) {
+            int file = ::open(logPath.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+            if (file < 0) return false;
+
+            struct stat info;
+            if (::fstat(file, &info) != 0) {
+                ::close(file);
+                return false;
+            }
+            size_t size = static_cast<size_t>(info.st_size);
+            if (size == 0) {
+                DecisionHeader header = {};
+                std::memcpy(header.magic, DecisionMagic, sizeof(DecisionMagic));
+                header.version = DecisionVersion;
+                pending.insert(0, reinterpret_cast<const char*>(&header), sizeof(header));
+            } else {
+                // never append to a file that is not a decision log of this version
+                DecisionHeader header = {};
+                if (::pread(file, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))
+                    || std::memcmp(header.magic, DecisionMagic, sizeof(DecisionMagic)) != 0 || header.version != DecisionVersion) {
+                    ::close(file);
+                    return false;
+                }
+                // drop a partial record left by a crash, so the new records stay aligned
+                size_t aligned = size - (size - sizeof(DecisionHeader)) % sizeof(DecisionRecord);
+                if (aligned != size && ::ftruncate(file, static_cast<off_t>(aligned)) != 0) {
+                    ::close(file);
+                    return false;
+                }
+            }
+            fd = file;
+        }
+
+        if (!writePending(fd, pending)) return false;
+
+        if (++unsynced >= interval) {
+            ::fdatasync(fd);
+            unsynced = 0;
+        }
+        return true;
+    }
+
+    bool DecisionLog::sync() {
+        bool ok = commit();
+        if (fd >= 0 && unsynced > 0) {
+            ok = ::fsync(fd) == 0 && ok;
+            unsynced = 0;
+        }
+        return ok;
+    }
+
+    void DecisionLog::close() {
+        sync();
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    long loadDecisions(const std::string& path, const std::vector<CausalConstructicon::CausalPattern>& patterns,
+        std::vector<AnnotationStore::PatternDecisions>& out) {
+        out.resize(patterns.size());
+
+        MappedFile file(path);
+        if (!file.isOpen() || file.size() < sizeof(DecisionHeader)) return -1;
+        const auto* header = reinterpret_cast<const DecisionHeader*>(file.data());
+        if (std::memcmp(header->magic, DecisionMagic, sizeof(DecisionMagic)) != 0 || header->version != DecisionVersion) return -1;
+
+        std::unordered_map<uint32_t, size_t> patternIndex;
+        for (size_t i = 0; i < patterns.size(); i++) {
+            patternIndex.emplace(patternKey(patterns[i]), i);
+        }
+
+        // one pass over the mapped records; consecutive decisions are usually on few patterns, so the last lookup is reused
+        const auto* decisions = reinterpret_cast<const DecisionRecord*>(file.data() + sizeof(DecisionHeader));
+        size_t count = (file.size() - sizeof(DecisionHeader)) / sizeof(DecisionRecord);
+        uint32_t lastKey = 0;
+        size_t lastIndex = patterns.size();
+        for (size_t i = 0; i < count; i++) {
+            const DecisionRecord& decision = decisions[i];
+            if (decision.patternKey != lastKey || lastIndex == patterns.size()) {
+                auto found = patternIndex.find(decision.patternKey);
+                lastKey = decision.patternKey;
+                lastIndex = found == patternIndex.end() ? patterns.size() : found->second;
+                if (lastIndex == patterns.size()) continue;
+            }
+
+            out[lastIndex].add(static_cast<AnnotationStatus>(decision.status), static_cast<ParseMethod>(decision.method));
+        }
+        return static_cast<long>(count);
+    }
+
+    long compactAnnotations(AnnotationLog& log, const std::string& csvPath) {
+        // everything appended so far has to be in the log file before it is read back
+        log.close();
+
+        std::string temporary = csvPath + ".tmp";
+        std::ofstream out(temporary, std::ios::trunc);
+        if (!out.is_open()) return -1;
+        out << AnnotationHeader;
+
+        // rows are normalized before comparing, so older rows without escaped quotes match their logged copies
+        std::unordered_set<std::string> seen;
+        long count = 0;
+        size_t malformed = 0;
+        auto fold = [&](const std::string& path) {
+            MappedFile file(path);
+            if (!file.isOpen()) return;
+            parseCSV(file.view(), [&](const std::vector<std::string_view>& fields) {
+                if (fields[0] == "construction_id") return;
+                if (fields.size() != 6 && fields.size() != 12) {
+                    malformed++;
+                    return;
+                }
+                std::string row = joinRow(fields[0], fields[1], fields[2], fields[3], fields[4], fields[5], rowOffsets(fields));
+                if (seen.insert(row).second) {
+                    out << row;
+                    count++;
+                }
+            });
+        };
+        fold(csvPath);
+        fold(log.path());
+
+        out.close();
+        if (!out) {
+            std::remove(temporary.c_str());
+            return -1;
+        }
+
+        // flush the new csv before it replaces the old one
+        int fd = ::open(temporary.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            ::fsync(fd);
+            ::close(fd);
+        }
+        if (std::rename(temporary.c_str(), csvPath.c_str()) != 0) {
+            std::remove(temporary.c_str());
+            return -1;
+        }
+
+        // if the program stops before this, the rows left in the log are dropped as duplicates next time
+        ::truncate(log.path().c_str(), 0);
+
+        if (malformed > 0) {
+            std::cerr << "Skipped " << malformed << " malformed rows while compacting " << csvPath << std::endl;
+        }
+        return count;
+    }
+
+    bool writeProgressFile(const std::string& path, size_t index) {
+        std::string temporary = path + ".tmp";
+        int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return false;
+
+        std::string text = std::to_string(index);
+        bool ok = ::write(fd, text.data(), text.size()) == static_cast<ssize_t>(text.size()) && ::fsync(fd) == 0;
+        ::close(fd);
+        if (!ok || std::rename(temporary.c_str(), path.c_str()) != 0) {
+            std::remove(temporary.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    PersistenceWriter::PersistenceWriter(AnnotationLog& annotationLog, DecisionLog& decisionLog, const std::string& progressPath,
+        size_t capacity) :
+    log(annotationLog), decisions(decisionLog), progressFile(progressPath), queue(capacity), stopping(false), failed(false),
+    eventsSubmitted(0), annotationsSubmitted(0), eventsDurable(0), annotationsDurable(0) {}
+
+    PersistenceWriter::~PersistenceWriter() {
+        stop();
+    }
+
+    void PersistenceWriter::start() {
+        if (running()) return;
+        stopping = false;
+        failed = false;
+        worker = std::thread(&PersistenceWriter::run, this);
+    }
+
+    void PersistenceWriter::stop() {
+        if (!running()) return;
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        worker.join();
+    }
+
+    void PersistenceWriter::submitAnnotation(const AnnotationEntry& entry) {
+        Event event;
+        event.row = annotationRow(entry);
+        submit(std::move(event));
+        annotationsSubmitted++;
+    }
+
+    void PersistenceWriter::submitDecision(const DecisionRecord& decision) {
+        Event event;
+        event.kind = Event::Kind::Decision;
+        event.decision = decision;
+        submit(std::move(event));
+    }
+
+    void PersistenceWriter::submitProgress(size_t index) {
+        Event event;
+        event.kind = Event::Kind::Progress;
+        event.index = index;
+        submit(std::move(event));
+    }
+
+    void PersistenceWriter::submit(Event&& event) {
+        // a full queue means the disk is far behind; wait for the writer rather than drop the event
+        while (!queue.push(std::move(event))) {
+            wake.notify_one();
+            std::this_thread::yield();
+        }
+        eventsSubmitted++;
+
+        // the lock only orders this wakeup with the writer going to sleep
+        { std::lock_guard<std::mutex> lock(wakeMutex); }
+        wake.notify_one();
+    }
+
+    bool PersistenceWriter::flush() {
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        done.wait(lock, [this]() { return eventsDurable.load() == eventsSubmitted || failed.load() || !running(); });
+        return !failed.load() && eventsDurable.load() == eventsSubmitted;
+    }
+
+    void PersistenceWriter::run() {
+        bool progressPending = false;
+        size_t progress = 0;
+        size_t events = 0;
+        size_t annotationEvents = 0;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(wakeMutex);
+                wake.wait(lock, [this]() { return stopping.load() || !queue.empty(); });
+            }
+
+            // group commit: everything queued by now goes into one write and one fsync
+            Event event;
+            while (queue.pop(event)) {
+                switch (event.kind) {
+                    case Event::Kind::Progress:
+                        progressPending = true;
+                        progress = event.index;
+                        break;
+                    case Event::Kind::Decision:
+                        decisions.append(event.decision);
+                        break;
+                    case Event::Kind::Annotation:
+                        log.appendRow(std::move(event.row));
+                        annotationEvents++;
+                        break;
+                }
+                events++;
+            }
+
+            if (events > 0) {
+                // a failed decision write is reported but does not hold back annotations or progress
+                if (!decisions.sync()) {
+                    std::cerr << "Failed to write decisions to " << decisions.path() << std::endl;
+                }
+                if (log.sync()) {
+                    // only the latest progress index matters, and only once the annotations before it are on disk
+                    if (progressPending && !writeProgressFile(progressFile, progress)) {
+                        std::cerr << "Failed to write progress to " << progressFile << std::endl;
+                    }
+                    progressPending = false;
+                    annotationsDurable += annotationEvents;
+                    eventsDurable += events;
+                    events = 0;
+                    annotationEvents = 0;
+                } else {
+                    // the rows stay queued in the log and are retried with the next group
+                    std::cerr << "Failed to write annotations to " << log.path() << std::endl;
+                    failed = true;
+                }
+                { std::lock_guard<std::mutex> lock(wakeMutex); }
+                done.notify_all();
+            }
+
+            if (stopping.load() && queue.empty()) break;
+        }
+    }
+
+    // helper: a saved offset column
+    static bool parseOffset(std::string_view field, uint32_t& value) {
+        if (field.empty() || field.size() > 9) return false;
+        value = 0;
+        for (char c : field) {
+            if (c < '0' || c > '9') return false;
+            value = value * 10 + static_cast<uint32_t>(c - '0');
+        }
+        return true;
+    }
+
+    // helper: span of a saved text in its record
+    // the saved offsets are used if the text is still there; otherwise (older rows without offsets, or a changed
+    // record) the text is located again, but only if it occurs exactly once, since any other occurrence
+    // may be the wrong one; ambiguous and missing texts are pooled, so overlap queries never see a guessed span
+    static TextSpan restoreSpan(std::string_view statement, std::string_view text, std::string_view start, std::string_view end) {
+        if (text.empty()) return TextSpan();
+        uint32_t s = 0;
+        uint32_t e = 0;
+        if (parseOffset(start, s) && parseOffset(end, e) && s <= e && e <= statement.size()
+            && statement.substr(s, e - s) == text) {
+            return TextSpan(s, e);
+        }
+
+        size_t pos = statement.find(text);
+        if (pos == std::string_view::npos || statement.find(text, pos + 1) != std::string_view::npos) {
+            return spanPool.keep(text);
+        }
+        return TextSpan(static_cast<uint32_t>(pos), static_cast<uint32_t>(pos + text.size()));
+    }
+
+    long loadAnnotations(const std::string& path, AnnotationStore& out, bool dedupe) {
+        MappedFile file(path);
+        if (!file.isOpen()) {
+            // a missing file is expected before the first session; an empty one has nothing to load
+            struct stat info;
+            return ::stat(path.c_str(), &info) == 0 ? 0 : -1;
+        }
+
+        // rows are compared in their normalized csv form, the same way compactAnnotations compares them
+        std::unordered_set<std::string> seen;
+        if (dedupe) {
+            seen.reserve(out.size());
+            for (size_t i = 0; i < out.size(); i++) seen.insert(annotationRow(out[i]));
+        }
+
+        // construction IDs repeat across rows, so each distinct ID is interned once
+        std::unordered_map<std::string_view, CausalConstructicon::ConstructionHandle> handles;
+        size_t before = out.size();
+        size_t malformed = 0;
+
+        // reserve by a rough estimate of the row count, so loading does not reallocate the vector repeatedly
+        out.reserve(before + file.size() / 160 + 1);
+
+        parseCSV(file.view(), [&](const std::vector<std::string_view>& fields) {
+            if (fields[0] == "construction_id") return;
+            if ((fields.size() != 6 && fields.size() != 12) || fields[1].empty()) {
+                malformed++;
+                return;
+            }
+
+            // digits only, and an ID that does not fit an int is malformed rather than wrapped
+            int recordID = 0;
+            const char* last = fields[1].data() + fields[1].size();
+            auto parsed = std::from_chars(fields[1].data(), last, recordID);
+            if (fields[1][0] == '-' || parsed.ec != std::errc() || parsed.ptr != last) {
+                malformed++;
+                return;
+            }
+
+            auto handle = handles.find(fields[0]);
+            if (handle == handles.end()) {
+                // the key has to outlive the row, so it points at the interned string rather than the field
+                CausalConstructicon::ConstructionHandle id{std::string(fields[0])};
+                handle = handles.emplace(id.str(), id).first;
+            }
+
+            AnnotationEntry entry(handle->second, recordID, "", "", "", annotationStatusFromString(fields[5]));
+            std::string_view statement = entry.recordIndex == NoRecord ? std::string_view() : records[entry.recordIndex].probableCause;
+            bool saved = fields.size() == 12;
+            entry.trigger = restoreSpan(statement, fields[2], saved ? fields[6] : "", saved ? fields[7] : "");
+            entry.cause = restoreSpan(statement, fields[3], saved ? fields[8] : "", saved ? fields[9] : "");
+            entry.effect = restoreSpan(statement, fields[4], saved ? fields[10] : "", saved ? fields[11] : "");
+
+            // rows are compared by their spans, so the same text at two offsets is not a duplicate
+            if (dedupe && !seen.insert(annotationRow(entry)).second) return;
+            out.add(entry);
+        });
+
+        if (malformed > 0) {
+            std::cerr << "Skipped " << malformed << " malformed rows in " << path << std::endl;
+        }
+        return static_cast<long>(out.size() - before);
+    }
+
     // save to csv file for further processing into graph
     // filter only saves verified annotations
-    // opens in append mode
+    // hands the entries added since the previous save to the persistence writer, which appends them to the
+    // annotation log in the background; without a running writer they are appended here
+    // compactAnnotations folds the log into annotations.csv
     void saveAnnotations() {
-        std::ofstream file("annotations.csv", std::ios::app);
-        
-        // write header only if file is empty
-        if (file.tellp() == 0) {
-        file << "construction_id,record_id,trigger,cause,effect,status\n";
-    }
-        int verifiedCount = 0;
-        
-        for (const auto& entry : annotations) {
-            if (entry.status == AnnotationStatus::Verified) {
-                file << entry.constructionID << ","
-                    << entry.recordID << ","
-                    << "\"" << entry.trigger << "\","
-                    << "\"" << entry.cause << "\","
-                    << "\"" << entry.effect << "\","
-                    << "Verified"
-                    << "\n";
-                verifiedCount++;
+        const auto& patterns = CausalConstructicon::getPatterns();
+        patternDecisions.resize(patterns.size());
+
+        for (; annotationLog.saved < annotations.size(); annotationLog.saved++) {
+            size_t row = annotationLog.saved;
+            uint32_t pattern = annotations.patternColumn()[row];
+            AnnotationStatus status = annotations.statusColumn()[row];
+
+            // every decision on a pattern match goes to the decision log, including rejections
+            if (pattern < patterns.size()) {
+                DecisionRecord decision = makeDecision(annotations[row]);
+                if (persistenceWriter.running()) {
+                    persistenceWriter.submitDecision(decision);
+                } else {
+                    decisionLog.append(decision);
+                }
+                patternDecisions[pattern].add(status, annotations.methodColumn()[row]);
+            }
+
+            if (status != AnnotationStatus::Verified) continue;
+            AnnotationEntry entry = annotations[row];
+            if (persistenceWriter.running()) {
+                persistenceWriter.submitAnnotation(entry);
+            } else {
+                annotationLog.append(entry);
             }
         }
-        
-        file.close();
 
-        std::cout << verifiedCount << " total verified annotations saved to annotations so far.csv\n";
+        if (persistenceWriter.running()) {
+            std::cout << persistenceWriter.submittedAnnotations() << " verified annotations saved to " << annotationLog.path() << " this session\n";
+            return;
+        }
+
+        if (!decisionLog.commit()) {
+            std::cerr << "Failed to write decisions to " << decisionLog.path() << std::endl;
+        }
+        if (!annotationLog.commit()) {
+            std::cerr << "Failed to write annotations to " << annotationLog.path() << std::endl;
+            return;
+        }
+
+        std::cout << annotationLog.rowCount() << " verified annotations saved to " << annotationLog.path() << " this session\n";
     }
-}
\ No newline at end of file
+}
@@ -3,8 +3,20 @@
 #define CONSTRUCTICON_SIMPLE_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <regex>
+#include <bitset>
+#include <deque>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <ostream>
 #include <fstream>
 #include "json.hpp"
 
@@ -81,6 +93,21 @@ inline std::string causalOrderToString(CausalOrder order) {
     }
 }
 
+// helper function to convert strings back to enums, for reading saved annotations
+inline AnnotationStatus annotationStatusFromString(std::string_view status) {
+    if (status == "Candidate") return AnnotationStatus::Candidate;
+    if (status == "Verified") return AnnotationStatus::Verified;
+    if (status == "Rejected") return AnnotationStatus::Rejected;
+    return AnnotationStatus::Unknown;
+}
+
+inline ParseMethod parseMethodFromString(std::string_view method) {
+    if (method == "FullAuto") return ParseMethod::FullAuto;
+    if (method == "SemiAuto") return ParseMethod::SemiAuto;
+    if (method == "Manual") return ParseMethod::Manual;
+    return ParseMethod::Unknown;
+}
+
 // namespace for the reference set of causal constructions and associated resources
 namespace CausalConstructicon {
 
@@ -102,23 +129,444 @@ namespace CausalConstructicon {
         id(i), degree(d), order(o), trigger_template(t), example(e) {}
     };
 
+    // compile-time entry of the builtin construction inventory in constructions.h
+    // same fields as CausalConstruction, but as views of string literals, so the whole table is constexpr
+    struct ConstructionEntry {
+        std::string_view id;
+        CausalDegree degree;
+        CausalOrder order;
+        std::string_view trigger_template;
+        std::string_view example;
+    };
+
+    // dense integer handle of an interned construction ID like "C146"
+    // builtin IDs get the index of their construction in constructions.h, other IDs (e.g. "TK" or IDs of
+    // constructions added at runtime) are interned on first use, so comparing and indexing by handle is O(1)
+    struct ConstructionHandle {
+        uint32_t value;
+
+        static constexpr uint32_t Invalid = 0xFFFFFFFFu;
+
+        // default constructor: no construction
+        ConstructionHandle() : value(Invalid) {}
+
+        // interning constructors, so IDs can still be written as strings, e.g. {"C001"}; "" gives no construction
+        ConstructionHandle(const char* id);
+        ConstructionHandle(const std::string& id);
+
+        // the interned ID string, or "" for no construction
+        const std::string& str() const;
+
+        bool valid() const { return value != Invalid; }
+        bool operator==(const ConstructionHandle& other) const { return value == other.value; }
+        bool operator!=(const ConstructionHandle& other) const { return value != other.value; }
+        bool operator<(const ConstructionHandle& other) const { return value < other.value; }
+    };
+
+    // print the ID string of a handle
+    std::ostream& operator<<(std::ostream& out, const ConstructionHandle& handle);
+
+    // handle of an ID without interning it; invalid if the ID has never been interned
+    ConstructionHandle lookupConstructionID(const std::string& id);
+
+    // number of interned IDs, i.e. the size of arrays indexed by handle value
+    size_t constructionHandleCount();
+
+    // lemma macros in pattern sources, expanded with the inflection lexicon
+    // entry of the inflection lexicon in lexicon.h: the forms of a verb that the spelling rules get wrong
+    // empty forms are regular
+    struct LexiconEntry {
+        std::string_view lemma;
+        std::string_view third;
+        std::string_view past;
+        std::string_view participle;
+        std::string_view gerund;
+    };
+
+    // surface forms of a verb (lowercase): lemma, third person singular, past, past participle, and gerund,
+    // without duplicates; irregular forms come from the lexicon, the others from spelling rules
+    std::vector<std::string> inflect(std::string_view lemma);
+
+    // replace every lemma macro in a regex source, e.g. {produce}, with a group of its surface forms,
+    // (produce|produces|produced|producing); braces that do not enclose a lowercase word are kept
+    std::string expandLemmas(const std::string& source);
+
+    // regex equivalent of a gapped pattern: anchor, 1 to maxGap tokens that do not end a sentence, closing
+    std::regex gappedRegex(const std::string& anchor, unsigned int maxGap, const std::string& closing);
+
     // pattern for mapping regex string patterns to construction IDs
     struct CausalPattern {
         // corresponds to trigger_template in the construction
         std::string description;
-        // compiled regex
-        std::regex  pattern;           
-        // one or more construction IDs (e.g., {"C001"})      
-        std::vector<std::string> ids;        
+        // regex source, e.g. R"(\bis\s+why\b)"; empty if the pattern was built from a compiled regex only
+        // for a gapped pattern, the source of its anchor
+        std::string source;
+        // gapped patterns (discontinuous constructions, e.g. "the aftermath of <cause> is"): source of the closing
+        // that has to follow the anchor in the same sentence, after 1 to maxGap tokens; empty for other patterns
+        std::string closing;
+        unsigned int maxGap;
+        // one or more construction IDs (e.g., {"C001"}), interned as handles
+        std::vector<ConstructionHandle> ids;
         // parse method; can be set during annotation process
         ParseMethod parse_method;  
 
         // default constructor
-        CausalPattern() : description(""), pattern(std::regex("")), ids({}), parse_method(ParseMethod::Unknown) {}
+        CausalPattern() : description(""), source(""), closing(""), maxGap(0), ids({}), parse_method(ParseMethod::Unknown) {}
         
-        // parameterized constructor
-        CausalPattern(const std::string& d, const std::regex& p, const std::vector<std::string>& i, ParseMethod m = ParseMethod::Unknown) :
-        description(d), pattern(p), ids(i), parse_method(m) {}
+        // parameterized constructor from a regex source (case-insensitive); the source is kept for the pattern matcher
+        // lemma macros like {cause} are expanded to all forms of the verb first
+        CausalPattern(const std::string& d, const std::string& s, const std::vector<ConstructionHandle>& i, ParseMethod m = ParseMethod::Unknown) :
+        description(d), source(expandLemmas(s)), closing(""), maxGap(0), ids(i), parse_method(m) {}
+
+        // parameterized constructor of a gapped pattern from the regex sources of its anchor and closing
+        CausalPattern(const std::string& d, const std::string& a, unsigned int g, const std::string& c, const std::vector<ConstructionHandle>& i, ParseMethod m = ParseMethod::Unknown) :
+        description(d), source(expandLemmas(a)), closing(expandLemmas(c)), maxGap(g), ids(i), parse_method(m) {}
+
+        // parameterized constructor from a compiled regex; the matcher falls back to std::regex for these
+        CausalPattern(const std::string& d, const std::regex& p, const std::vector<ConstructionHandle>& i, ParseMethod m = ParseMethod::Unknown) :
+        description(d), source(""), closing(""), maxGap(0), ids(i), parse_method(m), compiled(std::make_shared<const std::regex>(p)) {}
+
+        // the std::regex of the pattern, compiled from the source on first use: the matcher compiles most
+        // patterns itself, so most processes never build one; copies made before the first use compile their own
+        // not thread-safe; the matcher takes the regexes it needs while it is built, before it is shared
+        const std::regex& regex() const;
+
+        bool gapped() const { return !closing.empty(); }
+
+    private:
+        mutable std::shared_ptr<const std::regex> compiled;
+    };
+
+    // a single hit of a pattern in a text
+    // start and end are byte offsets into the text, end is one past the last character of the trigger
+    struct PatternMatch {
+        size_t patternIndex;
+        size_t start;
+        size_t end;
+
+        // default constructor
+        PatternMatch() : patternIndex(0), start(0), end(0) {}
+
+        // parameterized constructor with initialization list
+        PatternMatch(size_t p, size_t s, size_t e) : patternIndex(p), start(s), end(e) {}
+    };
+
+    // segments of a text as byte offsets (end is one past the last byte), each kind in text order
+    // • tokens: runs of non-space bytes without their leading or trailing punctuation; runs of punctuation only are no tokens
+    // • sentences: end with '.', '!', or '?' before whitespace or the end of the text
+    // • clauses: parts of a sentence separated by ';' before whitespace (commas are too ambiguous in lists and
+    //   appositions to separate clauses, and colons introduce the lists of causes in the statements)
+    // • words: runs of word bytes as defined by \b, for the word-sequence patterns of the matcher, with their
+    //   interned lowercase IDs, and whether only whitespace separates each word from the one before it
+    struct Segment {
+        uint32_t start;
+        uint32_t end;
+    };
+
+    struct TextSegments {
+        std::vector<Segment> tokens;
+        std::vector<Segment> clauses;
+        std::vector<Segment> sentences;
+        std::vector<Segment> words;
+        std::vector<uint32_t> wordIDs;
+        std::vector<uint8_t> spaceBefore;
+    };
+
+    // interned lowercase words: each distinct word gets a dense ID
+    // interning is not thread-safe; words are interned when records are loaded and when a matcher is compiled
+    class TokenDictionary {
+    public:
+        static constexpr uint32_t NoToken = 0xFFFFFFFFu;
+
+        // ID of word, added if it is new
+        uint32_t intern(const std::string& word);
+
+        // ID of word, or NoToken if it was never interned
+        uint32_t find(const std::string& word) const;
+
+        size_t size() const { return ids.size(); }
+
+        // word of an interned ID
+        const std::string& word(uint32_t id) const { return *words[id]; }
+
+    private:
+        std::unordered_map<std::string, uint32_t> ids;
+        // keys of ids by ID; nodes of an unordered_map do not move
+        std::vector<const std::string*> words;
+    };
+
+    extern TokenDictionary tokenDictionary;
+
+    // append the segments of text to out; with intern, new words are added to the token dictionary,
+    // otherwise they get NoToken (no pattern can contain them)
+    void segmentText(std::string_view text, TextSegments& out, bool intern = false);
+
+    // read-only view of the segments of one text, e.g. of one record in the segment index
+    struct SegmentView {
+        const Segment* tokens;
+        size_t tokenCount;
+        const Segment* clauses;
+        size_t clauseCount;
+        const Segment* sentences;
+        size_t sentenceCount;
+        const Segment* words;
+        const uint32_t* wordIDs;
+        const uint8_t* spaceBefore;
+        size_t wordCount;
+
+        // default constructor: no segments
+        SegmentView() : tokens(nullptr), tokenCount(0), clauses(nullptr), clauseCount(0), sentences(nullptr), sentenceCount(0),
+        words(nullptr), wordIDs(nullptr), spaceBefore(nullptr), wordCount(0) {}
+
+        // view of all segments of a text
+        explicit SegmentView(const TextSegments& s) :
+        tokens(s.tokens.data()), tokenCount(s.tokens.size()), clauses(s.clauses.data()), clauseCount(s.clauses.size()),
+        sentences(s.sentences.data()), sentenceCount(s.sentences.size()),
+        words(s.words.data()), wordIDs(s.wordIDs.data()), spaceBefore(s.spaceBefore.data()), wordCount(s.words.size()) {}
+
+        // number of tokens that start in [from, to)
+        size_t tokensBetween(size_t from, size_t to) const;
+
+        // index of the sentence or clause at pos: the last one that starts at or before pos (0 if there is none)
+        size_t sentenceAt(size_t pos) const;
+        size_t clauseAt(size_t pos) const;
+    };
+
+    // per pattern counters of the matcher, filled by match when a profile is passed
+    // counters are atomic, so one profile can be shared by threads matching different records
+    // • evaluations: records in which the pattern passed the literal prefilter and was evaluated
+    // • bytes: bytes of those records scanned for the pattern
+    // • nanoseconds: time spent evaluating the pattern
+    // • hits: matches before overlap resolution
+    // • verified, rejected: annotator decisions on the pattern's candidates (see addDecisions)
+    class PatternProfile {
+    public:
+        struct Counters {
+            uint64_t evaluations;
+            uint64_t bytes;
+            uint64_t nanoseconds;
+            uint64_t hits;
+            uint64_t verified;
+            uint64_t rejected;
+        };
+
+        explicit PatternProfile(size_t patternCount);
+
+        PatternProfile(const PatternProfile&) = delete;
+        PatternProfile& operator=(const PatternProfile&) = delete;
+
+        size_t size() const { return counters.size(); }
+
+        void addScan(size_t patternIndex, uint64_t bytes, uint64_t nanoseconds);
+        void addHit(size_t patternIndex) { counters[patternIndex].hits.fetch_add(1, std::memory_order_relaxed); }
+        void addDecisions(size_t patternIndex, uint64_t verified, uint64_t rejected);
+
+        // snapshot of one pattern's counters
+        Counters operator[](size_t patternIndex) const;
+
+        // report of every evaluated pattern, most expensive first: as an aligned table, and as a JSON array
+        void writeTable(std::ostream& out, const std::vector<CausalPattern>& patterns) const;
+        nlohmann::ordered_json toJSON(const std::vector<CausalPattern>& patterns) const;
+
+    private:
+        struct AtomicCounters {
+            std::atomic<uint64_t> evaluations{0};
+            std::atomic<uint64_t> bytes{0};
+            std::atomic<uint64_t> nanoseconds{0};
+            std::atomic<uint64_t> hits{0};
+            std::atomic<uint64_t> verified{0};
+            std::atomic<uint64_t> rejected{0};
+        };
+
+        // pattern indices ordered by time, then hits
+        std::vector<size_t> byCost() const;
+
+        std::vector<AtomicCounters> counters;
+    };
+
+    // compiled matcher for a set of patterns
+    // every pattern whose source is in the supported regex subset (literals, \b, \B, \s, ., groups,
+    // alternation, and greedy or lazy *, +, ?) is compiled into one shared program (a union NFA),
+    // and the text is scanned once for all of them at the same time
+    // word-sequence patterns (e.g. "gives rise to") are compiled into a trie over interned word IDs instead,
+    // and matched on the words of the text
+    // patterns outside of the subset fall back to std::regex
+    class PatternMatcher {
+    public:
+        // version of the compiled form, part of every pattern set hash; bump it when the compiler changes
+        static constexpr uint32_t FormatVersion = 1;
+
+        // the compiled form of a pattern set as flat arrays, everything but the std::regex fallbacks,
+        // so it can be generated as C++ tables (see pattern_codegen) and loaded without compiling again
+        // trie words are stored as strings, since word IDs are only interned when the matcher is loaded
+        struct Image {
+            // patternSetHash of the patterns it was compiled from
+            uint64_t patternSetHash = 0;
+            // op, byte, x, y per instruction
+            std::vector<uint32_t> program;
+            // entry, closing entry, most gap tokens, priority, searched per pattern
+            std::vector<uint32_t> patterns;
+            // 4 words of first bytes, then 4 of closing first bytes per pattern
+            std::vector<uint64_t> firstBytes;
+            // distinct required literals, and the indices of each pattern's literals from literalOffsets[i]
+            // to literalOffsets[i + 1]
+            std::vector<std::string> literals;
+            std::vector<uint32_t> literalOffsets;
+            std::vector<uint32_t> literalIndices;
+            // edge begin, edge end, terminal begin, terminal end per trie node
+            std::vector<uint32_t> trie;
+            // child and word per trie edge
+            std::vector<uint32_t> trieEdges;
+            std::vector<std::string> trieWords;
+            // pattern, rank per trie terminal
+            std::vector<uint32_t> trieTerminals;
+
+            // whether the arrays fit together and every index is in range, for patternCount patterns
+            bool consistent(size_t patternCount) const;
+        };
+
+        // default constructor: matcher with no patterns
+        PatternMatcher() {}
+
+        // compile all patterns into one program
+        explicit PatternMatcher(const std::vector<CausalPattern>& patterns);
+
+        // load a matcher compiled from patterns before; the image must be consistent for patterns
+        // and its hash equal to patternSetHash(patterns), only the std::regex fallbacks are built from patterns
+        PatternMatcher(const std::vector<CausalPattern>& patterns, const Image& image);
+
+        // the compiled form of this matcher, tagged with the hash of the patterns it was compiled from
+        Image image(uint64_t patternSetHash) const;
+
+        // find all non-overlapping leftmost matches of every searched pattern in text, ordered by start offset and pattern index
+        // with a profile, patterns are scanned one after another instead of together, so each can be timed
+        // gapped patterns use the segments of the text if they are given, and segment the text themselves otherwise
+        std::vector<PatternMatch> match(std::string_view text, PatternProfile* profile = nullptr, const SegmentView* segments = nullptr) const;
+
+        // number of patterns the matcher was compiled from
+        size_t size() const { return entry.size(); }
+
+        // number of patterns compiled into the shared program or the word trie (the rest use std::regex)
+        size_t compiledCount() const;
+
+        // whether a pattern is a word sequence (only words, \s+ between them, alternatives, and optional parts,
+        // delimited by \b), matched in the word trie instead of the program
+        bool wordPattern(size_t patternIndex) const { return entry[patternIndex] == WordEntry; }
+
+        // literals (lowercase) of which at least one occurs in every match of a pattern
+        // empty if the pattern has no required literal, in which case it is always evaluated
+        std::vector<std::string> requiredLiterals(size_t patternIndex) const;
+
+        // which patterns can possibly match text, based on their required literals; Manual patterns never can
+        // text must already be lowercase
+        std::vector<bool> candidatePatterns(const std::string& lowerText) const;
+
+        // whether a pattern is searched at all: patterns with ParseMethod::Manual are only entered by hand
+        bool searched(size_t patternIndex) const { return searchedPatterns[patternIndex]; }
+
+        // priority of a pattern for overlap resolution: 0 if it subsumes no other pattern,
+        // otherwise one more than the highest priority among the patterns it subsumes
+        // e.g. "because of" (C125) subsumes "because" (C102), and "the probable cause of" (M001) subsumes "cause" (C146)
+        unsigned int priority(size_t patternIndex) const { return priorities[patternIndex]; }
+
+        // keep one match per trigger region: of overlapping matches, keep the one with the highest priority,
+        // then the longest, then the earliest; matches must be ordered by start offset, as returned by match
+        std::vector<PatternMatch> resolveOverlaps(const std::vector<PatternMatch>& matches) const;
+
+    private:
+        // parses pattern sources and emits their instructions into program
+        friend struct PatternCompiler;
+
+        // instructions of the shared program
+        enum class Op : unsigned char { Char, Space, Any, Split, Jump, WordBoundary, NotWordBoundary, Match };
+
+        struct Instruction {
+            Op op;
+            unsigned char c;
+            unsigned int x;
+            unsigned int y;
+        };
+
+        // a thread of the NFA simulation: program counter and start offset of the match in progress
+        struct Thread {
+            unsigned int pc;
+            size_t start;
+        };
+
+        // state of the simulation of one pattern, or of the anchor or closing of a gapped pattern
+        struct PatternState {
+            size_t index;
+            bool closing;
+            std::vector<Thread> current;
+            std::vector<Thread> next;
+            size_t searchFrom;
+            bool matched;
+            size_t matchStart;
+            size_t matchEnd;
+        };
+
+        void addThread(std::vector<Thread>& list, std::vector<size_t>& marks, unsigned int pc, size_t start,
+            const std::string& text, size_t pos) const;
+
+        // advance one pattern's threads over the byte at pos (pos == text size for the end of the text)
+        void step(PatternState& state, std::vector<size_t>& marks, const std::string& text, size_t pos,
+            std::vector<PatternMatch>& matches) const;
+
+        // match the word-sequence patterns on the words of a text
+        void matchWords(const SegmentView& segments, const std::vector<bool>& candidates, std::vector<PatternMatch>& matches) const;
+
+        // join the anchor and closing matches of a gapped pattern, each in text order, into its matches
+        void joinGaps(const std::string& text, const SegmentView& segments, size_t pattern, const std::vector<PatternMatch>& anchors,
+            const std::vector<PatternMatch>& closings, std::vector<PatternMatch>& matches) const;
+
+        std::vector<Instruction> program;
+        // entry point of each pattern in program, or NoEntry if the pattern uses the std::regex fallback
+        // (for a gapped pattern, the entry point of its anchor)
+        std::vector<unsigned int> entry;
+        // bytes (lowercase) that can start a match of each pattern; a thread is only started on these
+        std::vector<std::bitset<256>> firstBytes;
+        // entry point and first bytes of the closing of each gapped pattern, NoEntry for other patterns
+        std::vector<unsigned int> closingEntry;
+        std::vector<std::bitset<256>> closingFirstBytes;
+        // most tokens between anchor and closing, per gapped pattern
+        std::vector<unsigned int> maxGap;
+        // regexes of the fallback patterns, indexed like entry
+        std::vector<std::regex> fallback;
+        // distinct required literals of all patterns, and the indices of each pattern's literals
+        std::vector<std::string> literals;
+        std::vector<std::vector<unsigned int>> patternLiterals;
+        // overlap resolution priorities, precomputed from pattern subsumption
+        std::vector<unsigned int> priorities;
+        // false for Manual patterns, which are compiled but never searched
+        std::vector<bool> searchedPatterns;
+
+        // trie of the word sequences of all word-sequence patterns, over interned word IDs; node 0 is the root
+        // each node has a range of edges (sorted by word ID) and a range of terminals: the patterns with a
+        // sequence that ends there, and the rank of that sequence in the pattern's leftmost-first order
+        struct TrieEdge {
+            uint32_t word;
+            uint32_t child;
+        };
+
+        struct TrieTerminal {
+            uint32_t pattern;
+            uint32_t rank;
+        };
+
+        struct TrieNode {
+            uint32_t edgeBegin;
+            uint32_t edgeEnd;
+            uint32_t terminalBegin;
+            uint32_t terminalEnd;
+        };
+
+        std::vector<TrieNode> trie;
+        std::vector<TrieEdge> trieEdges;
+        std::vector<TrieTerminal> trieTerminals;
+
+        static constexpr unsigned int NoEntry = 0xFFFFFFFFu;
+        // entry of the patterns that are matched in the trie
+        static constexpr unsigned int WordEntry = 0xFFFFFFFEu;
     };
 
     //  storage vector declarations
@@ -129,12 +577,53 @@ namespace CausalConstructicon {
     std::vector<CausalConstruction>& getConstructions(); 
     std::vector<CausalPattern>& getPatterns();
 
+    // hash of everything a compiled matcher depends on: the source, closing, gap, and parse method of every
+    // pattern in order (the description for patterns without a source), and PatternMatcher::FormatVersion
+    uint64_t patternSetHash(const std::vector<CausalPattern>& patterns);
+
+    // matcher compiled from all patterns, on first use; recompiled after patterns are added
+    // while the patterns hash to the generated tables of pattern_tables.h, it is loaded from those instead,
+    // otherwise from the matcher cache (if one is set) if an earlier process compiled the same pattern set
+    const PatternMatcher& getMatcher();
+
+    // matcher cache file that getMatcher reads, and writes when it compiles a pattern set; "" (the default) for none,
+    // so only programs that ask for it leave a file behind; the annotation session uses pattern_matcher.bin
+    void setMatcherCachePath(const std::string& path);
+
+    // matcher cache file, written by getMatcher when it compiles a pattern set
+    // layout: header, then the arrays of a PatternMatcher::Image as sections in the order of the header,
+    // each 8-byte aligned; string arrays are an offset column (count + 1 entries) and a byte section
+    // all numbers are little-endian
+    constexpr size_t MatcherCacheSections = 12;
+
+    struct MatcherCacheHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t patternCount;
+        uint64_t patternSetHash;
+        // program, patterns, firstBytes, literalOffsets, literalIndices, literal text offsets, literal text,
+        // trie, trieEdges, trie word offsets, trie word text, trieTerminals
+        uint64_t sectionOffsets[MatcherCacheSections];
+        uint64_t sectionCounts[MatcherCacheSections];
+    };
+
+    constexpr char MatcherCacheMagic[8] = {'C', 'C', 'M', 'A', 'T', 'C', 'H', 'R'};
+    constexpr uint32_t MatcherCacheVersion = 1;
+
+    // write a matcher image compiled from patternCount patterns to a cache file
+    bool writeMatcherCache(const std::string& path, const PatternMatcher::Image& image, size_t patternCount);
+
+    // read the image in a cache file; false if there is none, or it is of another version or pattern set
+    // the file is mapped and its sections copied out, so the image does not depend on the mapping
+    bool readMatcherCache(const std::string& path, uint64_t patternSetHash, size_t patternCount, PatternMatcher::Image& image);
+
     // functions to add new constructions and patterns
     void addConstruction(const CausalConstruction& construction);
     void addPattern(const CausalPattern& pattern);
 
     // find helper function declarations
     const CausalConstruction* findConstructionByID(const std::string& id);
+    const CausalConstruction* findConstruction(ConstructionHandle handle);
 
     struct ConstructiconInitializer;
 
@@ -146,27 +635,175 @@ namespace CausalConstructicon {
 namespace Annotator {
     using json = nlohmann::json;
 
+    // read-only memory mapping of a whole file; pages are shared with every other process that maps it
+    class MappedFile {
+    public:
+        // default constructor: nothing mapped
+        MappedFile() : bytes(nullptr), length(0) {}
+
+        // map the file at path; isOpen() is false if it cannot be opened or is empty
+        explicit MappedFile(const std::string& path);
+
+        ~MappedFile();
+
+        // movable but not copyable, since the mapping is owned
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool isOpen() const { return bytes != nullptr; }
+        const char* data() const { return bytes; }
+        size_t size() const { return length; }
+        std::string_view view() const { return std::string_view(bytes, length); }
+
+    private:
+        const char* bytes;
+        size_t length;
+    };
+
     // unannotated record consisting of a key (in this case, the NTSB record ID) and probable cause statement
+    // the statement is a view of the bytes owned by the record store, so records are cheap to copy
     struct Record {
         int recordID;
-        std::string probableCause;
+        std::string_view probableCause;
 
         // default constructor
-        Record() : recordID(0), probableCause("") {}
+        Record() : recordID(0), probableCause() {}
 
         // parameterized constructor with initialization list
-        Record(int r, const std::string& p) : 
+        Record(int r, std::string_view p) : 
         recordID(r), probableCause(p) {}
     };
 
+    // owner of the bytes behind all record views: the memory-mapped corpus file, plus the few
+    // statements that are not stored verbatim in the file (JSON strings with escapes) and had to be decoded
+    struct RecordStore {
+        MappedFile file;
+        std::deque<std::string> decoded;
+
+        // keep a decoded statement alive for the lifetime of the store and return a view of it
+        std::string_view keep(std::string&& text) {
+            decoded.push_back(std::move(text));
+            return decoded.back();
+        }
+    };
+
+    extern RecordStore recordStore;
+
+    // segments of every record, computed once when the records are loaded: one column per kind of segment
+    // in record order, plus the first token, clause, and sentence of each record
+    class SegmentIndex {
+    public:
+        // segment all records; replaces the previous index
+        void build(const std::vector<Record>& records);
+
+        // number of records in the index
+        size_t size() const { return tokenBegin.empty() ? 0 : tokenBegin.size() - 1; }
+
+        // segments of the record at recordIndex
+        CausalConstructicon::SegmentView operator[](size_t recordIndex) const;
+
+    private:
+        CausalConstructicon::TextSegments all;
+        std::vector<uint32_t> wordBegin;
+        std::vector<uint32_t> tokenBegin;
+        std::vector<uint32_t> clauseBegin;
+        std::vector<uint32_t> sentenceBegin;
+    };
+
+    extern SegmentIndex segmentIndex;
+
+    // segments of a record: from the index if the record is indexed, otherwise computed into scratch
+    CausalConstructicon::SegmentView recordSegments(const Record& record, CausalConstructicon::TextSegments& scratch);
+
+    // binary columnar corpus file, written by corpus_converter from the NTSB JSON
+    // layout: header, record ID column (int32), text offset column (uint64, recordCount + 1 entries,
+    // relative to the text blob), text blob; sections are 8-byte aligned and all numbers are little-endian
+    struct CorpusHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t recordCount;
+        uint64_t idsOffset;
+        uint64_t textOffsetsOffset;
+        uint64_t textOffset;
+        uint64_t textSize;
+    };
+
+    constexpr char CorpusMagic[8] = {'N', 'T', 'S', 'B', 'C', 'R', 'P', 'S'};
+    constexpr uint32_t CorpusVersion = 1;
+
+    // load records from the NTSB JSON (array of objects with cm_mkey and cm_probableCause) into store and out
+    bool loadRecordsFromJSON(const std::string& path, RecordStore& store, std::vector<Record>& out);
+
+    // load records from a binary corpus file into store and out; the text is not copied
+    bool loadRecordsFromCorpus(const std::string& path, RecordStore& store, std::vector<Record>& out);
+
+    // write records to a binary corpus file
+    bool writeCorpus(const std::string& path, const std::vector<Record>& records);
+
+    // number of records in a binary corpus file, from its header alone; 0 if the file is not a valid corpus
+    size_t corpusRecordCount(const std::string& path);
+
+    // span of annotated text: byte offsets in a record's statement (end is one past the last character)
+    // text that does not occur in the record (a typo in a pasted span, or a saved row whose record is not loaded)
+    // is kept in the span pool instead; then start is Pooled and end is the index of the text in the pool
+    struct TextSpan {
+        uint32_t start;
+        uint32_t end;
+
+        static constexpr uint32_t Pooled = 0xFFFFFFFF;
+
+        // default constructor: empty span
+        TextSpan() : start(0), end(0) {}
+
+        // parameterized constructor with initialization list
+        TextSpan(uint32_t s, uint32_t e) : start(s), end(e) {}
+
+        bool pooled() const { return start == Pooled; }
+        bool empty() const { return !pooled() && start == end; }
+
+        // both spans are offsets into the same record and share at least one byte
+        bool overlaps(const TextSpan& other) const {
+            return !pooled() && !other.pooled() && start < other.end && other.start < end;
+        }
+
+        bool contains(const TextSpan& other) const {
+            return !pooled() && !other.pooled() && start <= other.start && other.end <= end;
+        }
+    };
+
+    // owner of span texts that could not be located in their record
+    struct SpanPool {
+        std::deque<std::string> texts;
+
+        // keep a text and return the span that refers to it
+        TextSpan keep(std::string_view text) {
+            texts.emplace_back(text);
+            return TextSpan(TextSpan::Pooled, static_cast<uint32_t>(texts.size() - 1));
+        }
+    };
+
+    extern SpanPool spanPool;
+
+    // span of the first occurrence of span in text, or a pooled copy if it does not occur
+    TextSpan locateSpan(std::string_view text, std::string_view span);
+
+    // index of the record with recordID in records, or NoRecord
+    constexpr uint32_t NoRecord = 0xFFFFFFFF;
+
+    // pattern index of annotations that were not found by a pattern (manual entries, reloaded rows)
+    constexpr uint32_t NoPattern = 0xFFFFFFFF;
+    uint32_t findRecordIndex(int recordID);
+
     // helper functions for annotation process
-    // get user input for text span
-    std::string getTextSpan(const std::string& prompt, const std::string& fullText);
+    // get user input for text span and locate it in the record text
+    TextSpan getTextSpan(const std::string& prompt, std::string_view fullText);
     
     // show the record
     void displayRecord(const Record& record);
 
-    // save the current index for progress tracking 
+    // save the current index for progress tracking (through the persistence writer while it runs)
     void saveCurrentIndex(size_t index);
 
     // load the last saved index for prgress tracking
@@ -175,42 +812,396 @@ namespace Annotator {
     // option to continue or exit after annotating each record
     bool optionToContinue();
 
-    // save after annotating each record
+    // save after annotating each record: append the verified entries added since the last save to the annotation log
     void saveAnnotations();
 
     // annotation entry with causal construction ID, record ID, trigger, cause, effect, status, and parse method
-    // may be expanded to include token start and end indices for trigger, cause, and effect
+    // trigger, cause, and effect are spans of the record at recordIndex rather than copies of the text,
+    // so an entry holds no text of its own; the text is looked up when it is shown or exported
+    // patternIndex is the pattern that found the trigger, or NoPattern
     struct AnnotationEntry {
-        std::string constructionID;
+        CausalConstructicon::ConstructionHandle constructionID;
         int recordID;
-        std::string trigger;
-        std::string cause;
-        std::string effect;
+        uint32_t recordIndex;
+        TextSpan trigger;
+        TextSpan cause;
+        TextSpan effect;
         AnnotationStatus status;
         ParseMethod parse_method;
+        uint32_t patternIndex;
         
         // default constructor
-        AnnotationEntry() : constructionID(""), recordID(0), status(AnnotationStatus::Unknown), parse_method(ParseMethod::Unknown) {}
+        AnnotationEntry() : constructionID(), recordID(0), recordIndex(NoRecord), status(AnnotationStatus::Unknown),
+        parse_method(ParseMethod::Unknown), patternIndex(NoPattern) {}
 
-        // parameterized constructor with initialization list
-        AnnotationEntry(const std::string& cid,
+        // parameterized constructor with initialization list, for spans already located in the record
+        AnnotationEntry(CausalConstructicon::ConstructionHandle cid,
             int r,
-            const std::string& t,
-            const std::string& ca,
-            const std::string& e,
+            uint32_t index,
+            TextSpan t,
+            TextSpan ca,
+            TextSpan e,
             AnnotationStatus s = AnnotationStatus::Unknown,
             ParseMethod m = ParseMethod::Unknown)
-            : constructionID(cid), recordID(r), trigger(t), cause(ca), effect(e), status(s), parse_method(m)
+            : constructionID(cid), recordID(r), recordIndex(index), trigger(t), cause(ca), effect(e), status(s), parse_method(m),
+            patternIndex(NoPattern)
         {}
+
+        // constructor from text, e.g. a saved row: the record is looked up by ID and each text is located in it
+        AnnotationEntry(CausalConstructicon::ConstructionHandle cid,
+            int r,
+            std::string_view t,
+            std::string_view ca,
+            std::string_view e,
+            AnnotationStatus s = AnnotationStatus::Unknown,
+            ParseMethod m = ParseMethod::Unknown);
+
+        // text of one of the spans of this entry; valid as long as the records and the span pool
+        std::string_view text(const TextSpan& span) const;
+
+        std::string_view triggerText() const { return text(trigger); }
+        std::string_view causeText() const { return text(cause); }
+        std::string_view effectText() const { return text(effect); }
+    };
+
+    // columnar store of annotation entries: each field is a contiguous column, and entry i is row i of all columns
+    // queries scan only the columns they need; byRecord and byConstruction are secondary indexes of row numbers,
+    // kept up to date by add(), so the annotations of one record or one construction are found without a scan
+    class AnnotationStore {
+    public:
+        // append an entry and index it; returns its row
+        size_t add(const AnnotationEntry& entry);
+
+        // the entry at row i, assembled from the columns
+        AnnotationEntry operator[](size_t i) const;
+
+        size_t size() const { return statuses.size(); }
+        bool empty() const { return statuses.empty(); }
+        void reserve(size_t n);
+        void clear();
+
+        // columns
+        const std::vector<CausalConstructicon::ConstructionHandle>& constructionColumn() const { return constructionIDs; }
+        const std::vector<int>& recordColumn() const { return recordIDs; }
+        const std::vector<AnnotationStatus>& statusColumn() const { return statuses; }
+        const std::vector<ParseMethod>& methodColumn() const { return methods; }
+        const std::vector<uint32_t>& patternColumn() const { return patternIndices; }
+
+        // secondary indexes: rows of a record or construction, in the order they were added
+        const std::vector<uint32_t>& byRecord(int recordID) const;
+        const std::vector<uint32_t>& byConstruction(CausalConstructicon::ConstructionHandle id) const;
+
+        // rows of a construction with a status, e.g. all Verified C148 annotations
+        std::vector<uint32_t> select(CausalConstructicon::ConstructionHandle id, AnnotationStatus status) const;
+
+        // number of rows with a status
+        size_t count(AnnotationStatus status) const;
+
+        // verified, rejected, and skipped (candidate) counts per pattern index (patternCount entries; rows without a pattern are not counted)
+        // matches of FullAuto patterns are verified without a prompt, so they count as autoVerified and not as decisions:
+        // precision is that of the human decisions, which is what a pattern's parse method is tuned by
+        struct PatternDecisions {
+            size_t verified = 0;
+            size_t rejected = 0;
+            size_t candidates = 0;
+            size_t autoVerified = 0;
+
+            void add(AnnotationStatus status, ParseMethod method) {
+                if (status == AnnotationStatus::Verified && method == ParseMethod::FullAuto) {
+                    autoVerified++;
+                } else {
+                    verified += status == AnnotationStatus::Verified;
+                    rejected += status == AnnotationStatus::Rejected;
+                    candidates += status == AnnotationStatus::Candidate;
+                }
+            }
+
+            // share of decisions that were verifications, or 0 without decisions
+            double precision() const {
+                return verified + rejected == 0 ? 0.0 : static_cast<double>(verified) / static_cast<double>(verified + rejected);
+            }
+
+            // share of decisions that were rejections, or 0 without decisions
+            double rejectionRate() const {
+                return verified + rejected == 0 ? 0.0 : static_cast<double>(rejected) / static_cast<double>(verified + rejected);
+            }
+        };
+        std::vector<PatternDecisions> decisionsPerPattern(size_t patternCount) const;
+
+    private:
+        std::vector<CausalConstructicon::ConstructionHandle> constructionIDs;
+        std::vector<int> recordIDs;
+        std::vector<uint32_t> recordIndices;
+        std::vector<TextSpan> triggers;
+        std::vector<TextSpan> causes;
+        std::vector<TextSpan> effects;
+        std::vector<AnnotationStatus> statuses;
+        std::vector<ParseMethod> methods;
+        std::vector<uint32_t> patternIndices;
+
+        std::unordered_map<int, std::vector<uint32_t>> recordRows;
+        // indexed by handle value, since handles are dense
+        std::vector<std::vector<uint32_t>> constructionRows;
     };
 
     //  storage vector declarations
     extern std::vector<Record> records;
-    extern std::vector<AnnotationEntry> annotations;
+    extern AnnotationStore annotations;
 
-    std::vector<AnnotationEntry>& getAnnotations();
+    AnnotationStore& getAnnotations();
     void addAnnotationEntry(const AnnotationEntry& entry);
 
+    // quote a csv field, doubling any quotes inside
+    std::string csvField(std::string_view text);
+
+    // split csv text into rows and call row with the fields of each one
+    // quoted fields may contain commas, line breaks, and doubled quotes; a quote inside a quoted field
+    // that is not followed by a delimiter is taken literally, as older versions did not escape them
+    // the field views are only valid during the call
+    void parseCSV(std::string_view text, const std::function<void(const std::vector<std::string_view>&)>& row);
+
+    // annotations.csv row for an entry: construction_id,record_id,trigger,cause,effect,status, then the start and end
+    // offsets of trigger, cause, and effect in the record (empty for pooled spans)
+    std::string annotationRow(const AnnotationEntry& entry);
+
+    // append-only log of verified annotations, with the same columns as annotations.csv
+    // each commit writes only the rows appended since the previous one, so saving costs the same however
+    // long the session runs; the file is flushed to disk every syncInterval commits and on sync() or close()
+    class AnnotationLog {
+    public:
+        explicit AnnotationLog(const std::string& path = "annotations.log", size_t syncInterval = 8);
+        ~AnnotationLog();
+
+        AnnotationLog(const AnnotationLog&) = delete;
+        AnnotationLog& operator=(const AnnotationLog&) = delete;
+
+        // queue a row for the next commit
+        void append(const AnnotationEntry& entry);
+        void appendRow(std::string&& row);
+
+        // write the queued rows to the log; false if the file cannot be opened or written
+        bool commit();
+
+        // commit and flush the log to disk now
+        bool sync();
+
+        // sync and close the file; the next commit reopens it
+        void close();
+
+        const std::string& path() const { return logPath; }
+        size_t rowCount() const { return rows; }
+
+        // index of the first entry in annotations that has not been appended yet
+        size_t saved;
+
+    private:
+        std::string logPath;
+        size_t interval;
+        size_t unsynced;
+        size_t rows;
+        int fd;
+        std::string pending;
+    };
+
+    extern AnnotationLog annotationLog;
+
+    // one decision on a pattern match (verified, rejected, or left as a candidate), 16 bytes in decisions.bin
+    // the pattern is identified by a hash of its source rather than its index, so the log stays valid
+    // when patterns are added or reordered
+    struct DecisionRecord {
+        int32_t recordID;
+        uint32_t patternKey;
+        uint32_t start;
+        uint16_t length;
+        uint8_t status;
+        uint8_t method;
+    };
+    static_assert(sizeof(DecisionRecord) == 16, "decision records are 16 bytes on disk");
+
+    // decisions.bin starts with this header, followed by the records; all numbers are little-endian
+    struct DecisionHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+    };
+    static_assert(sizeof(DecisionHeader) == sizeof(DecisionRecord), "records stay aligned after the header");
+
+    constexpr char DecisionMagic[8] = {'N', 'T', 'S', 'B', 'D', 'E', 'C', 'S'};
+    constexpr uint32_t DecisionVersion = 1;
+
+    // hash of a pattern's source (or its description, for patterns without one), used as its key in the decision log
+    uint32_t patternKey(const CausalConstructicon::CausalPattern& pattern);
+
+    // decision record of an entry found by a pattern
+    DecisionRecord makeDecision(const AnnotationEntry& entry);
+
+    // append-only binary log of pattern decisions, written like the annotation log
+    class DecisionLog {
+    public:
+        explicit DecisionLog(const std::string& path = "decisions.bin", size_t syncInterval = 8);
+        ~DecisionLog();
+
+        DecisionLog(const DecisionLog&) = delete;
+        DecisionLog& operator=(const DecisionLog&) = delete;
+
+        // queue a record for the next commit
+        void append(const DecisionRecord& decision);
+
+        // write the queued records; false if the file cannot be opened or written
+        bool commit();
+
+        // commit and flush the log to disk now
+        bool sync();
+
+        // sync and close the file; the next commit reopens it
+        void close();
+
+        const std::string& path() const { return logPath; }
+
+    private:
+        std::string logPath;
+        size_t interval;
+        size_t unsynced;
+        int fd;
+        std::string pending;
+    };
+
+    extern DecisionLog decisionLog;
+
+    // count the decisions in a decision log per pattern index of patterns; decisions on patterns that no longer
+    // exist are skipped, and so is a partial record at the end of the file (e.g. after a crash while writing)
+    // every decision counts, including repeated decisions on the same match
+    // returns the number of decisions read, or -1 if the file is not a decision log of this version
+    long loadDecisions(const std::string& path, const std::vector<CausalConstructicon::CausalPattern>& patterns,
+        std::vector<AnnotationStore::PatternDecisions>& out);
+
+    // decisions per pattern index: those of earlier sessions, loaded at startup, plus those saved since
+    extern std::vector<AnnotationStore::PatternDecisions> patternDecisions;
+
+    // single-producer single-consumer ring buffer; push and pop never block or take a lock
+    // capacity is rounded up to a power of two
+    template <typename T>
+    class SPSCQueue {
+    public:
+        explicit SPSCQueue(size_t capacity) : slots(roundUp(capacity)), mask(slots.size() - 1), head(0), tail(0) {}
+
+        // producer side: false if the queue is full
+        bool push(T&& value) {
+            size_t at = tail.load(std::memory_order_relaxed);
+            if (at - head.load(std::memory_order_acquire) == slots.size()) return false;
+            slots[at & mask] = std::move(value);
+            tail.store(at + 1, std::memory_order_release);
+            return true;
+        }
+
+        // consumer side: false if the queue is empty
+        bool pop(T& value) {
+            size_t at = head.load(std::memory_order_relaxed);
+            if (at == tail.load(std::memory_order_acquire)) return false;
+            value = std::move(slots[at & mask]);
+            head.store(at + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool empty() const {
+            return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+        }
+
+    private:
+        static size_t roundUp(size_t n) {
+            size_t size = 1;
+            while (size < n) size <<= 1;
+            return size;
+        }
+
+        std::vector<T> slots;
+        size_t mask;
+        // on separate cache lines, so the two threads do not invalidate each other's index
+        alignas(64) std::atomic<size_t> head;
+        alignas(64) std::atomic<size_t> tail;
+    };
+
+    // write the progress index to a temporary file and rename it over path, so the file is never half-written
+    bool writeProgressFile(const std::string& path, size_t index);
+
+    // background writer for annotations, decisions, and progress, so the annotation prompts never wait for the disk
+    // the UI thread submits events to a lock-free queue; the writer thread drains everything queued at once
+    // and commits it as a group: one write and one fsync of each log, then the latest progress index only
+    // progress is written after the annotations before it are on disk, so after a crash it never skips a record
+    // whose annotations were lost; stop() drains the queue before it returns
+    class PersistenceWriter {
+    public:
+        PersistenceWriter(AnnotationLog& annotationLog, DecisionLog& decisionLog, const std::string& progressPath = "progress.txt",
+            size_t capacity = 1024);
+
+        // stops the thread, writing everything that was submitted
+        ~PersistenceWriter();
+
+        PersistenceWriter(const PersistenceWriter&) = delete;
+        PersistenceWriter& operator=(const PersistenceWriter&) = delete;
+
+        void start();
+        void stop();
+        bool running() const { return worker.joinable(); }
+
+        // called from one thread only (the UI thread)
+        void submitAnnotation(const AnnotationEntry& entry);
+        void submitDecision(const DecisionRecord& decision);
+        void submitProgress(size_t index);
+
+        // wait until everything submitted so far is on disk; false if a write failed
+        bool flush();
+
+        // number of annotations submitted, and number known to be on disk
+        size_t submittedAnnotations() const { return annotationsSubmitted; }
+        size_t durableAnnotations() const { return annotationsDurable.load(); }
+
+    private:
+        // annotations are formatted on the submitting thread, so the writer never reads records or the span pool
+        struct Event {
+            enum class Kind : unsigned char { Annotation, Decision, Progress };
+            Kind kind = Kind::Annotation;
+            size_t index = 0;
+            std::string row;
+            DecisionRecord decision = {};
+        };
+
+        void submit(Event&& event);
+        void run();
+
+        AnnotationLog& log;
+        DecisionLog& decisions;
+        std::string progressFile;
+        SPSCQueue<Event> queue;
+        std::thread worker;
+
+        std::atomic<bool> stopping;
+        std::atomic<bool> failed;
+        size_t eventsSubmitted;
+        size_t annotationsSubmitted;
+        std::atomic<size_t> eventsDurable;
+        std::atomic<size_t> annotationsDurable;
+
+        // only used to sleep and wake; the events themselves go through the queue
+        std::mutex wakeMutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+    };
+
+    extern PersistenceWriter persistenceWriter;
+
+    // read saved annotations (annotations.csv, or an annotation log) from a memory-mapped file and append them to out
+    // statuses are mapped back to AnnotationStatus and construction IDs to handles; the header and rows without
+    // six fields (older files) or twelve fields are skipped; rows already in out from an earlier call are skipped if dedupe is set
+    // spans are restored from the saved offsets; a text without valid offsets is located again only if it occurs
+    // once in the record, and pooled otherwise
+    // returns the number of entries appended, or -1 if the file cannot be opened
+    long loadAnnotations(const std::string& path, AnnotationStore& out, bool dedupe = false);
+
+    // fold the log into a deduplicated annotations.csv (written to a temporary file, then renamed) and empty the log
+    // rows are kept in the order they were first written; returns the number of rows in the csv, or -1 on failure
+    long compactAnnotations(AnnotationLog& log = annotationLog, const std::string& csvPath = "annotations.csv");
+
     struct AnnotatorInitializer;
 
     extern AnnotatorInitializer annotatorInitializer;
@@ -228,14 +1219,84 @@ namespace Annotator {
     // process one record
     bool processRecord(size_t recordIndex);
     
-    // highlight the trigger in different colors based on the status
+    // highlight the trigger between the byte offsets start and end in different colors based on the status
     // green: Verified
     // yellow: Candidate
     // red: Rejected
-    void displayTextWithHighlight(const std::string& trigger, AnnotationStatus status);
+    void displayTextWithHighlight(size_t start, size_t end, AnnotationStatus status);
+
+    // render the text with the bytes [start, end) highlighted in the color of the status (see displayTextWithHighlight)
+    std::string renderHighlight(std::string_view text, size_t start, size_t end, AnnotationStatus status);
+
+    // matching work for one record that does not need the annotator: its candidates after overlap resolution,
+    // and the record rendered with each candidate highlighted, indexed like hits
+    struct PreparedRecord {
+        size_t recordIndex;
+        std::vector<CausalConstructicon::PatternMatch> hits;
+        std::vector<std::string> highlights;
+
+        // default constructor
+        PreparedRecord() : recordIndex(NoRecord) {}
+    };
+
+    // match and render one record
+    PreparedRecord prepareRecord(const Record& record);
 
-    // find all pattern matches in current record
+    // look-ahead pipeline: a worker thread prepares the records after the current one while the annotator
+    // reviews it, and keeps up to depth of them in a bounded queue, so the next record is ready at once
+    // records must be taken in increasing order; the patterns must not change while it runs
+    class RecordPrefetcher {
+    public:
+        explicit RecordPrefetcher(size_t depth = 4);
+
+        // stops the worker
+        ~RecordPrefetcher();
+
+        RecordPrefetcher(const RecordPrefetcher&) = delete;
+        RecordPrefetcher& operator=(const RecordPrefetcher&) = delete;
+
+        // prepare records from firstRecord on
+        void start(size_t firstRecord);
+        void stop();
+        bool running() const { return worker.joinable(); }
+
+        // the prepared record at recordIndex, waiting for the worker if it is not ready yet;
+        // prepared on the calling thread if the worker is not running or has already passed it
+        PreparedRecord take(size_t recordIndex);
+
+    private:
+        void run(size_t firstRecord);
+
+        size_t depth;
+        std::deque<PreparedRecord> ready;
+        bool stopping;
+        bool finished;
+        std::mutex mutex;
+        std::condition_variable available;
+        std::condition_variable space;
+        std::thread worker;
+    };
+
+    extern RecordPrefetcher recordPrefetcher;
+
+    // find all pattern matches in current record (every non-overlapping match of every searched pattern)
+    // FullAuto matches are verified without a prompt, SemiAuto (and unclassified) matches are shown for validation
     std::vector<AnnotationEntry> findPatternMatches(const Record& record);
+
+    // the same, for a record whose matches were already prepared
+    std::vector<AnnotationEntry> findPatternMatches(const Record& record, const PreparedRecord& prepared);
+
+    // heuristic cause and effect spans for a trigger at [start, end) in text, used for auto-verified matches
+    // the trigger's clause is split at the trigger, and the pattern description (e.g. "<effect> because <cause>")
+    // tells which side is the cause; if both slots follow the trigger (e.g. "the probable cause of <effect> was <cause>"),
+    // or the trigger is fronted (e.g. "Contributing to <effect> was <cause>"), the rest of the clause is split at its
+    // first "was", "is", "were", or "are"
+    void heuristicSpans(const std::string& description, std::string_view text, size_t start, size_t end,
+        TextSpan& cause, TextSpan& effect);
+
+    // the same, with the segments of text already computed
+    void heuristicSpans(const std::string& description, std::string_view text, const CausalConstructicon::SegmentView& segments,
+        size_t start, size_t end, TextSpan& cause, TextSpan& effect);
     
     // process a single match (user interaction)
     AnnotationEntry processMatch(const CausalConstructicon::CausalPattern& pattern, 
@@ -243,4 +1304,14 @@ namespace Annotator {
         const Record& record);
 }
 
+// hash for handles, so they can be used as keys of unordered containers
+namespace std {
+    template <>
+    struct hash<CausalConstructicon::ConstructionHandle> {
+        size_t operator()(const CausalConstructicon::ConstructionHandle& handle) const {
+            return std::hash<uint32_t>()(handle.value);
+        }
+    };
+}
+
 #endif // CONSTRUCTICON_SIMPLE_H
\ No newline at end of file
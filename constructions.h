@@ -2,18 +2,21 @@
 // These are the non-noisy, non-complex causal constructions from the reference set
 // used as a starter set to initialize the constructions vector.
 // Some IDs are skipped because the constructions are too noisy or complex for now.
+// The table is constexpr: duplicate IDs are a compile error, and IDs are looked up with a
+// perfect hash that is also built at compile time, so nothing runs at program start.
 
 #ifndef CONSTRUCTIONS_H
 #define CONSTRUCTIONS_H
 
 #include "constructicon-simple.h"
-#include <initializer_list>
+#include <cstdint>
+#include <string_view>
 
-using CausalConstruction = CausalConstructicon::CausalConstruction;
+using ConstructionEntry = CausalConstructicon::ConstructionEntry;
 
 namespace InitialConstructions { 
 
-const std::initializer_list<CausalConstruction> constructions = {
+constexpr ConstructionEntry constructions[] = {
     
 {
     "C001",
@@ -1346,6 +1349,128 @@ const std::initializer_list<CausalConstruction> constructions = {
     "The probable cause of the accident was distraction."
 }
 };
+
+// number of builtin constructions
+constexpr size_t count = sizeof(constructions) / sizeof(constructions[0]);
+
+// compile-time duplicate ID check
+constexpr bool hasDuplicateIDs() {
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = i + 1; j < count; j++) {
+            if (constructions[i].id == constructions[j].id) return true;
+        }
+    }
+    return false;
+}
+
+static_assert(!hasDuplicateIDs(), "constructions.h contains a duplicate construction ID");
+
+// seeded FNV-1a hash with a final avalanche step, usable at compile time
+constexpr uint32_t hashID(std::string_view id, uint32_t seed) {
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (char c : id) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// perfect hash of the construction IDs (hash and displace):
+// IDs are grouped into buckets by one hash, and each bucket gets a seed for a second hash
+// that puts all of its IDs into free slots; buckets are placed largest first
+// not minimal: the slot count is the smallest power of two that leaves at least a quarter of the slots free,
+// so seeds are found quickly, and it grows with the inventory
+constexpr size_t idSlotCount(size_t n) {
+    size_t slots = 1;
+    while (slots < n + n / 3) slots <<= 1;
+    return slots;
+}
+
+struct IDIndex {
+    static constexpr size_t Buckets = count / 2 + 1;
+    static constexpr size_t Slots = idSlotCount(count);
+    static_assert(count < 0xFFFF, "IDIndex stores construction indices + 1 in 16 bits; widen slots for more constructions");
+
+    // seed of each bucket, and index + 1 of the construction in each slot (0 if free)
+    uint32_t seeds[Buckets] = {};
+    uint16_t slots[Slots] = {};
+    bool complete = false;
+
+    constexpr IDIndex() {
+        // duplicate IDs can never get separate slots; the static_assert above reports them
+        if (hasDuplicateIDs()) return;
+
+        size_t bucketSize[Buckets] = {};
+        for (size_t i = 0; i < count; i++) {
+            bucketSize[hashID(constructions[i].id, 0) % Buckets]++;
+        }
+
+        size_t order[Buckets] = {};
+        for (size_t b = 0; b < Buckets; b++) order[b] = b;
+        for (size_t i = 0; i < Buckets; i++) {
+            for (size_t j = i + 1; j < Buckets; j++) {
+                if (bucketSize[order[j]] > bucketSize[order[i]]) {
+                    size_t swap = order[i];
+                    order[i] = order[j];
+                    order[j] = swap;
+                }
+            }
+        }
+
+        for (size_t o = 0; o < Buckets; o++) {
+            size_t bucket = order[o];
+            if (bucketSize[bucket] == 0) break;
+
+            bool placed = false;
+            for (uint32_t seed = 1; seed < 10000 && !placed; seed++) {
+                // try the seed: every ID of the bucket needs its own free slot
+                size_t taken[count] = {};
+                size_t takenCount = 0;
+                bool fits = true;
+                for (size_t i = 0; i < count && fits; i++) {
+                    if (hashID(constructions[i].id, 0) % Buckets != bucket) continue;
+                    size_t slot = hashID(constructions[i].id, seed) & (Slots - 1);
+                    if (slots[slot] != 0) fits = false;
+                    for (size_t t = 0; t < takenCount && fits; t++) {
+                        if (taken[t] == slot) fits = false;
+                    }
+                    taken[takenCount++] = slot;
+                }
+                if (!fits) continue;
+
+                for (size_t i = 0; i < count; i++) {
+                    if (hashID(constructions[i].id, 0) % Buckets != bucket) continue;
+                    slots[hashID(constructions[i].id, seed) & (Slots - 1)] = static_cast<uint16_t>(i + 1);
+                }
+                seeds[bucket] = seed;
+                placed = true;
+            }
+            if (!placed) return;
+        }
+        complete = true;
+    }
+
+    // index of the construction with this ID in constructions, or -1 if it is not builtin
+    constexpr int find(std::string_view id) const {
+        uint32_t seed = seeds[hashID(id, 0) % Buckets];
+        if (seed == 0) return -1;
+        uint16_t slot = slots[hashID(id, seed) & (Slots - 1)];
+        if (slot == 0 || constructions[slot - 1].id != id) return -1;
+        return slot - 1;
+    }
+};
+
+constexpr IDIndex idIndex;
+
+static_assert(idIndex.complete, "no perfect hash found for the construction IDs");
+static_assert(idIndex.find("C001") == 0, "construction ID lookup is broken");
+static_assert(idIndex.find("M001") == count - 1, "construction ID lookup is broken");
+static_assert(idIndex.find("Z999") == -1, "construction ID lookup is broken");
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,32 @@
+// corpus_converter.cpp
+// converts the NTSB JSON records into the binary columnar corpus format,
+// which the annotator, batch extractor, and checker load instead of the JSON when it is present
+
+#include "constructicon-simple.h"
+#include <iostream>
+#include <cstdlib>
+
+int main(int argc, char* argv[]) {
+    // usage: ./corpus_converter [input json] [output corpus]
+    std::string inputFile = argc > 1 ? argv[1] : "cleaned_data.json";
+    std::string outputFile = argc > 2 ? argv[2] : "cleaned_data.bin";
+
+    // always read the JSON itself, independent of what the static initializer loaded
+    Annotator::RecordStore store;
+    std::vector<Annotator::Record> records;
+    if (!Annotator::loadRecordsFromJSON(inputFile, store, records)) {
+        std::cerr << "Conversion failed: could not read " << inputFile << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (!Annotator::writeCorpus(outputFile, records)) {
+        std::cerr << "Conversion failed: could not write " << outputFile << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "\n*** Corpus Conversion ***" << std::endl;
+    std::cout << "Records: " << Annotator::corpusRecordCount(outputFile) << std::endl;
+    std::cout << "Corpus written to " << outputFile << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,48 @@
+// Inflection lexicon for the lemma macros in pattern sources: {cause} stands for (cause|causes|caused|causing).
+// Regular verbs need no entry; their forms follow the spelling rules in inflect.
+// The table lists the verbs the rules get wrong: irregular verbs and verbs that double their final consonant.
+// An empty form is the regular one.
+
+#ifndef LEXICON_H
+#define LEXICON_H
+
+#include "constructicon-simple.h"
+
+using LexiconEntry = CausalConstructicon::LexiconEntry;
+
+namespace InitialLexicon {
+
+constexpr LexiconEntry entries[] = {
+//   lemma          third person    past            participle      gerund
+    {"arise",       "",             "arose",        "arisen",       ""},
+    {"begin",       "",             "began",        "begun",        "beginning"},
+    {"bring",       "",             "brought",      "",             ""},
+    {"come",        "",             "came",         "come",         ""},
+    {"compel",      "",             "compelled",    "",             "compelling"},
+    {"do",          "does",         "did",          "done",         ""},
+    {"drive",       "",             "drove",        "driven",       ""},
+    {"fall",        "",             "fell",         "fallen",       ""},
+    {"forbid",      "",             "forbade",      "forbidden",    "forbidding"},
+    {"get",         "",             "got",          "gotten",       "getting"},
+    {"give",        "",             "gave",         "given",        ""},
+    {"go",          "goes",         "went",         "gone",         ""},
+    {"have",        "has",          "had",          "",             ""},
+    {"keep",        "",             "kept",         "",             ""},
+    {"lead",        "",             "led",          "",             ""},
+    {"let",         "",             "let",          "",             "letting"},
+    {"make",        "",             "made",         "",             ""},
+    {"occur",       "",             "occurred",     "",             "occurring"},
+    {"permit",      "",             "permitted",    "",             "permitting"},
+    {"put",         "",             "put",          "",             "putting"},
+    {"run",         "",             "ran",          "run",          "running"},
+    {"see",         "",             "saw",          "seen",         "seeing"},
+    {"set",         "",             "set",          "",             "setting"},
+    {"stem",        "",             "stemmed",      "",             "stemming"},
+    {"stop",        "",             "stopped",      "",             "stopping"},
+    {"take",        "",             "took",         "taken",        ""},
+    {"throw",       "",             "threw",        "thrown",       ""},
+};
+
+}
+
+#endif // LEXICON_H
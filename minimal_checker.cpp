@@ -7,6 +7,17 @@ int main() {
     std::cout << "Causal Patterns: " << CausalConstructicon::getPatterns().size() << std::endl;
     std::cout << "Accident Records: " << Annotator::records.size() << std::endl;
     std::cout << "Annotations: " << Annotator::getAnnotations().size() << std::endl;
+
+    // precision of each pattern from the decision log, for patterns with decisions
+    size_t decisionCount = 0;
+    for (const auto& d : Annotator::patternDecisions) decisionCount += d.verified + d.rejected + d.candidates + d.autoVerified;
+    std::cout << "Pattern Decisions: " << decisionCount << std::endl;
+    for (size_t i = 0; i < Annotator::patternDecisions.size(); i++) {
+        const auto& d = Annotator::patternDecisions[i];
+        if (d.verified + d.rejected + d.candidates + d.autoVerified == 0) continue;
+        std::cout << "  " << d.precision() << " precision (" << d.verified << " verified, " << d.rejected << " rejected, "
+                  << d.candidates << " undecided, " << d.autoVerified << " auto-verified)\t" << CausalConstructicon::getPatterns()[i].description << std::endl;
+    }
     
     // construction sample 
     if (!CausalConstructicon::getConstructions().empty()) {
@@ -47,9 +58,9 @@ int main() {
         std::cout << "\nSample Annotation:" << std::endl;
         std::cout << "Construction ID: " << a.constructionID << std::endl;
         std::cout << "Record ID: " << a.recordID << std::endl;
-        std::cout << "Trigger: " << a.trigger << std::endl;
-        std::cout << "Cause: " << a.cause << std::endl;
-        std::cout << "Effect: " << a.effect << std::endl;
+        std::cout << "Trigger: " << a.triggerText() << std::endl;
+        std::cout << "Cause: " << a.causeText() << std::endl;
+        std::cout << "Effect: " << a.effectText() << std::endl;
     } else {
         std::cout << "\nSample annotation: (none yet)" << std::endl;
     }
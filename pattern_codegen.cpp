@@ -0,0 +1,264 @@
+// pattern_codegen.cpp
+// generates patterns.h and pattern_tables.h from patterns.tsv, the file the patterns are maintained in
+// patterns.h holds the patterns the annotator starts with; pattern_tables.h holds the matcher compiled from them,
+// which the annotator loads instead of compiling as long as its patterns hash to the same pattern set
+// re-run it and rebuild after every change to patterns.tsv
+
+#include "constructicon-simple.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <charconv>
+#include <cstdlib>
+
+namespace CC = CausalConstructicon;
+
+// one line of the pattern file, as written
+struct PatternRow {
+    std::string description;
+    std::string source;
+    std::vector<std::string> ids;
+    std::string parseMethod;
+    std::string maxGap;
+    std::string closing;
+};
+
+static std::vector<std::string> splitFields(const std::string& line, char separator) {
+    std::vector<std::string> fields;
+    std::stringstream stream(line);
+    std::string field;
+    while (std::getline(stream, field, separator)) {
+        fields.push_back(field);
+    }
+    // a trailing separator ends an empty last field
+    if (!line.empty() && line.back() == separator) fields.push_back("");
+    return fields;
+}
+
+// read the pattern file: '#' lines are comments, the first other line is the column header
+static bool readPatternFile(const std::string& filename, std::vector<PatternRow>& rows) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open " << filename << std::endl;
+        return false;
+    }
+
+    std::string line;
+    size_t lineNumber = 0;
+    bool header = true;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty() || line[0] == '#') continue;
+        if (header) {
+            header = false;
+            continue;
+        }
+
+        std::vector<std::string> fields = splitFields(line, '\t');
+        bool extra = fields.size() > 6;
+        fields.resize(6);
+        if (extra || fields[0].empty() || fields[1].empty() || fields[2].empty()) {
+            std::cerr << filename << ":" << lineNumber << ": expected description, source, ids, parse method, "
+                << "and optionally max gap and closing, separated by tabs" << std::endl;
+            return false;
+        }
+        if (parseMethodFromString(fields[3]) == ParseMethod::Unknown) {
+            std::cerr << filename << ":" << lineNumber << ": unknown parse method \"" << fields[3] << "\"" << std::endl;
+            return false;
+        }
+        if (fields[4].empty() != fields[5].empty()
+            || (!fields[4].empty() && fields[4].find_first_not_of("0123456789") != std::string::npos)) {
+            std::cerr << filename << ":" << lineNumber << ": a gapped pattern needs a max gap (a number) and a closing" << std::endl;
+            return false;
+        }
+        // the max gap is an unsigned int in CausalPattern; a larger number would be truncated
+        unsigned int maxGap = 0;
+        if (!fields[4].empty() && std::from_chars(fields[4].data(), fields[4].data() + fields[4].size(), maxGap).ec != std::errc()) {
+            std::cerr << filename << ":" << lineNumber << ": max gap " << fields[4] << " is too large" << std::endl;
+            return false;
+        }
+        rows.push_back({fields[0], fields[1], splitFields(fields[2], ';'), fields[3], fields[4], fields[5]});
+    }
+    return true;
+}
+
+// C++ literal of a string: a raw string where possible, as patterns.h has always been written
+static std::string cppString(const std::string& text, bool raw) {
+    if (raw && text.find(")\"") == std::string::npos) return "R\"(" + text + ")\"";
+    std::ostringstream out;
+    out << '"';
+    for (unsigned char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (c < 0x20 || c >= 0x7F) {
+            // octal escapes take at most three digits, so a following digit is never read as part of one
+            out << '\\' << std::oct << std::setw(3) << std::setfill('0') << static_cast<unsigned int>(c) << std::dec;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+    return out.str();
+}
+
+static bool writePatternsHeader(const std::string& filename, const std::vector<PatternRow>& rows) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open " << filename << " for writing" << std::endl;
+        return false;
+    }
+
+    file << "// Generated by pattern_codegen from patterns.tsv; edit patterns.tsv and re-run pattern_codegen instead.\n"
+        << "// These are the regex patterns with matching construction IDs\n"
+        << "// used as a starter set to initialize the patterns vector.\n"
+        << "// Some IDs are skipped because the constructions are too noisy or complex for now.\n"
+        << "// Each pattern has a parse method: FullAuto triggers (e.g. \"because\") are verified without a prompt,\n"
+        << "// SemiAuto triggers are shown for validation, and Manual triggers (e.g. \"where\", \"so\") are not searched.\n"
+        << "// Verbs are written as lemma macros, e.g. {cause}, which expand to all their forms (see lexicon.h).\n"
+        << "// Discontinuous constructions (e.g. \"the aftermath of <cause> is\") are gapped patterns: an anchor, the most\n"
+        << "// tokens allowed before the closing, and a closing, which has to follow the anchor in the same sentence.\n"
+        << "\n"
+        << "#ifndef PATTERNS_H\n"
+        << "#define PATTERNS_H\n"
+        << "\n"
+        << "#include \"constructicon-simple.h\"\n"
+        << "\n"
+        << "using CausalPattern = CausalConstructicon::CausalPattern;\n"
+        << "\n"
+        << "#include <initializer_list>\n"
+        << "#include <regex>\n"
+        << "\n"
+        << "namespace InitialPatterns {\n"
+        << "\n"
+        << "const std::initializer_list<CausalPattern> patterns = {\n"
+        << "\n";
+
+    for (const auto& row : rows) {
+        file << "{\n"
+            << "    " << cppString(row.description, false) << ",\n"
+            << "    " << cppString(row.source, true);
+        if (!row.closing.empty()) file << ", " << row.maxGap << ", " << cppString(row.closing, true);
+        file << ",\n    {";
+        for (size_t i = 0; i < row.ids.size(); i++) {
+            file << (i > 0 ? ", " : "") << cppString(row.ids[i], false);
+        }
+        file << "},\n"
+            << "    ParseMethod::" << row.parseMethod << "\n"
+            << "},\n";
+    }
+
+    file << "};\n"
+        << "\n"
+        << "} \n"
+        << "\n"
+        << "#endif";
+    return file.good();
+}
+
+// one constexpr array of the generated tables, wrapped at a dozen values per line
+template <typename T, typename Format>
+static void writeTable(std::ostream& out, const char* type, const char* name, const std::vector<T>& values, Format format) {
+    out << "constexpr std::array<" << type << ", " << values.size() << "> " << name << " = {{";
+    for (size_t i = 0; i < values.size(); i++) {
+        out << (i % 12 == 0 ? "\n    " : " ") << format(values[i]) << (i + 1 < values.size() ? "," : "");
+    }
+    out << (values.empty() ? "" : "\n") << "}};\n\n";
+}
+
+static bool writeMatcherTables(const std::string& filename, const CC::PatternMatcher::Image& image, size_t patternCount) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open " << filename << " for writing" << std::endl;
+        return false;
+    }
+
+    auto number = [](uint32_t value) { return std::to_string(value) + "u"; };
+    auto hex = [](uint64_t value) {
+        std::ostringstream out;
+        out << "0x" << std::hex << std::setw(16) << std::setfill('0') << value << "ull";
+        return out.str();
+    };
+    auto string = [](const std::string& value) { return cppString(value, false); };
+
+    file << "// Generated by pattern_codegen from patterns.tsv; do not edit.\n"
+        << "// The matcher compiled from the " << patternCount << " patterns of patterns.h, as the flat arrays of\n"
+        << "// CausalConstructicon::PatternMatcher::Image. getMatcher loads it instead of compiling the patterns\n"
+        << "// while they hash to patternSetHash, and compiles them as soon as they differ.\n"
+        << "\n"
+        << "#ifndef PATTERN_TABLES_H\n"
+        << "#define PATTERN_TABLES_H\n"
+        << "\n"
+        << "#include <array>\n"
+        << "#include <cstdint>\n"
+        << "\n"
+        << "namespace GeneratedMatcher {\n"
+        << "\n"
+        << "constexpr uint64_t patternSetHash = " << hex(image.patternSetHash) << ";\n"
+        << "\n";
+    writeTable(file, "uint32_t", "program", image.program, number);
+    writeTable(file, "uint32_t", "patterns", image.patterns, number);
+    writeTable(file, "uint64_t", "firstBytes", image.firstBytes, hex);
+    writeTable(file, "const char*", "literals", image.literals, string);
+    writeTable(file, "uint32_t", "literalOffsets", image.literalOffsets, number);
+    writeTable(file, "uint32_t", "literalIndices", image.literalIndices, number);
+    writeTable(file, "uint32_t", "trie", image.trie, number);
+    writeTable(file, "uint32_t", "trieEdges", image.trieEdges, number);
+    writeTable(file, "const char*", "trieWords", image.trieWords, string);
+    writeTable(file, "uint32_t", "trieTerminals", image.trieTerminals, number);
+    file << "} \n"
+        << "\n"
+        << "#endif\n";
+    return file.good();
+}
+
+int main(int argc, char* argv[]) {
+    // usage: ./pattern_codegen [pattern file] [patterns header] [matcher tables header]
+    std::string inputFile = argc > 1 ? argv[1] : "patterns.tsv";
+    std::string patternsFile = argc > 2 ? argv[2] : "patterns.h";
+    std::string tablesFile = argc > 3 ? argv[3] : "pattern_tables.h";
+
+    std::vector<PatternRow> rows;
+    if (!readPatternFile(inputFile, rows)) {
+        std::cerr << "Code generation failed: could not read " << inputFile << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // the same patterns patterns.h will construct, independent of the ones this build was compiled with
+    std::vector<CC::CausalPattern> patterns;
+    for (const auto& row : rows) {
+        std::vector<CC::ConstructionHandle> ids(row.ids.begin(), row.ids.end());
+        ParseMethod method = parseMethodFromString(row.parseMethod);
+        try {
+            if (row.closing.empty()) {
+                patterns.emplace_back(row.description, row.source, ids, method);
+            } else {
+                patterns.emplace_back(row.description, row.source, static_cast<unsigned int>(std::stoul(row.maxGap)),
+                    row.closing, ids, method);
+            }
+            // regexes are compiled lazily; compile each once here, so an invalid source fails the generation
+            patterns.back().regex();
+        } catch (const std::exception& e) {
+            std::cerr << "Code generation failed: pattern \"" << row.description << "\": " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    CC::PatternMatcher matcher(patterns);
+    CC::PatternMatcher::Image image = matcher.image(CC::patternSetHash(patterns));
+
+    if (!writePatternsHeader(patternsFile, rows) || !writeMatcherTables(tablesFile, image, patterns.size())) {
+        std::cerr << "Code generation failed: could not write " << patternsFile << " and " << tablesFile << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "\n*** Pattern Code Generation ***" << std::endl;
+    std::cout << "Patterns: " << patterns.size() << " (" << matcher.compiledCount() << " compiled, "
+        << patterns.size() - matcher.compiledCount() << " std::regex fallbacks)" << std::endl;
+    std::cout << "Instructions: " << image.program.size() / 4 << ", trie nodes: " << image.trie.size() / 4 << std::endl;
+    std::cout << "Pattern set hash: " << std::hex << image.patternSetHash << std::dec << std::endl;
+    std::cout << "Patterns written to " << patternsFile << ", matcher tables to " << tablesFile << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,550 @@
+// Generated by pattern_codegen from patterns.tsv; do not edit.
+// The matcher compiled from the 92 patterns of patterns.h, as the flat arrays of
+// CausalConstructicon::PatternMatcher::Image. getMatcher loads it instead of compiling the patterns
+// while they hash to patternSetHash, and compiles them as soon as they differ.
+
+#ifndef PATTERN_TABLES_H
+#define PATTERN_TABLES_H
+
+#include <array>
+#include <cstdint>
+
+namespace GeneratedMatcher {
+
+constexpr uint64_t patternSetHash = 0xa7b19e9a0798eaf2ull;
+
+constexpr std::array<uint32_t, 2072> program = {{
+    5u, 0u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 97u, 0u, 0u,
+    0u, 118u, 0u, 0u, 0u, 105u, 0u, 0u, 0u, 110u, 0u, 0u,
+    0u, 103u, 0u, 0u, 3u, 0u, 8u, 10u, 1u, 0u, 0u, 0u,
+    4u, 0u, 7u, 0u, 0u, 44u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 1u, 0u, 5u, 0u, 0u, 0u, 0u, 44u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 15u, 17u, 0u, 97u, 0u, 0u,
+    0u, 115u, 0u, 0u, 5u, 0u, 0u, 0u, 7u, 0u, 2u, 0u,
+    5u, 0u, 0u, 0u, 0u, 105u, 0u, 0u, 0u, 102u, 0u, 0u,
+    3u, 0u, 25u, 27u, 1u, 0u, 0u, 0u, 4u, 0u, 24u, 0u,
+    0u, 44u, 0u, 0u, 5u, 0u, 0u, 0u, 7u, 0u, 18u, 0u,
+    5u, 0u, 0u, 0u, 0u, 115u, 0u, 0u, 0u, 104u, 0u, 0u,
+    0u, 111u, 0u, 0u, 0u, 117u, 0u, 0u, 0u, 108u, 0u, 0u,
+    0u, 100u, 0u, 0u, 3u, 0u, 38u, 40u, 1u, 0u, 0u, 0u,
+    4u, 0u, 37u, 0u, 0u, 44u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 19u, 0u, 5u, 0u, 0u, 0u, 0u, 111u, 0u, 0u,
+    0u, 110u, 0u, 0u, 0u, 99u, 0u, 0u, 0u, 101u, 0u, 0u,
+    3u, 0u, 49u, 51u, 1u, 0u, 0u, 0u, 4u, 0u, 48u, 0u,
+    0u, 44u, 0u, 0u, 5u, 0u, 0u, 0u, 7u, 0u, 32u, 0u,
+    5u, 0u, 0u, 0u, 0u, 44u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 56u, 58u, 0u, 115u, 0u, 0u, 0u, 105u, 0u, 0u,
+    0u, 110u, 0u, 0u, 0u, 99u, 0u, 0u, 0u, 101u, 0u, 0u,
+    5u, 0u, 0u, 0u, 7u, 0u, 33u, 0u, 5u, 0u, 0u, 0u,
+    0u, 44u, 0u, 0u, 1u, 0u, 0u, 0u, 3u, 0u, 67u, 69u,
+    0u, 97u, 0u, 0u, 0u, 110u, 0u, 0u, 0u, 100u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 72u, 74u, 0u, 116u, 0u, 0u,
+    0u, 104u, 0u, 0u, 0u, 101u, 0u, 0u, 0u, 110u, 0u, 0u,
+    5u, 0u, 0u, 0u, 7u, 0u, 34u, 0u, 5u, 0u, 0u, 0u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 101u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 84u, 86u, 0u, 97u, 0u, 0u,
+    0u, 102u, 0u, 0u, 0u, 116u, 0u, 0u, 0u, 101u, 0u, 0u,
+    0u, 114u, 0u, 0u, 0u, 109u, 0u, 0u, 0u, 97u, 0u, 0u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 95u, 97u, 0u, 111u, 0u, 0u, 0u, 102u, 0u, 0u,
+    5u, 0u, 0u, 0u, 7u, 0u, 35u, 0u, 5u, 0u, 0u, 0u,
+    0u, 105u, 0u, 0u, 0u, 115u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 35u, 0u, 5u, 0u, 0u, 0u, 0u, 44u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 108u, 110u, 0u, 97u, 0u, 0u,
+    0u, 110u, 0u, 0u, 0u, 100u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 113u, 115u, 0u, 99u, 0u, 0u, 0u, 111u, 0u, 0u,
+    0u, 110u, 0u, 0u, 0u, 115u, 0u, 0u, 0u, 101u, 0u, 0u,
+    0u, 113u, 0u, 0u, 0u, 117u, 0u, 0u, 0u, 101u, 0u, 0u,
+    0u, 110u, 0u, 0u, 0u, 116u, 0u, 0u, 0u, 108u, 0u, 0u,
+    0u, 121u, 0u, 0u, 0u, 44u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 45u, 0u, 5u, 0u, 0u, 0u, 0u, 59u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 132u, 134u, 0u, 104u, 0u, 0u,
+    0u, 101u, 0u, 0u, 0u, 110u, 0u, 0u, 0u, 99u, 0u, 0u,
+    0u, 101u, 0u, 0u, 0u, 44u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 46u, 0u, 5u, 0u, 0u, 0u, 0u, 59u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 144u, 146u, 0u, 116u, 0u, 0u,
+    0u, 104u, 0u, 0u, 0u, 101u, 0u, 0u, 0u, 114u, 0u, 0u,
+    0u, 101u, 0u, 0u, 0u, 102u, 0u, 0u, 0u, 111u, 0u, 0u,
+    0u, 114u, 0u, 0u, 0u, 101u, 0u, 0u, 0u, 44u, 0u, 0u,
+    5u, 0u, 0u, 0u, 7u, 0u, 47u, 0u, 5u, 0u, 0u, 0u,
+    0u, 44u, 0u, 0u, 1u, 0u, 0u, 0u, 3u, 0u, 160u, 162u,
+    0u, 115u, 0u, 0u, 0u, 111u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 49u, 0u, 5u, 0u, 0u, 0u, 0u, 44u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 168u, 170u, 0u, 97u, 0u, 0u,
+    0u, 110u, 0u, 0u, 0u, 100u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 173u, 175u, 0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u,
+    0u, 117u, 0u, 0u, 0u, 115u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 50u, 0u, 5u, 0u, 0u, 0u, 0u, 103u, 0u, 0u,
+    0u, 105u, 0u, 0u, 0u, 118u, 0u, 0u, 0u, 101u, 0u, 0u,
+    0u, 110u, 0u, 0u, 3u, 0u, 188u, 190u, 1u, 0u, 0u, 0u,
+    4u, 0u, 187u, 0u, 0u, 44u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 52u, 0u, 5u, 0u, 0u, 0u, 0u, 105u, 0u, 0u,
+    0u, 110u, 0u, 0u, 1u, 0u, 0u, 0u, 3u, 0u, 196u, 198u,
+    0u, 97u, 0u, 0u, 0u, 110u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 200u, 202u, 0u, 97u, 0u, 0u, 0u, 116u, 0u, 0u,
+    0u, 116u, 0u, 0u, 0u, 101u, 0u, 0u, 0u, 109u, 0u, 0u,
+    0u, 112u, 0u, 0u, 0u, 116u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 209u, 211u, 0u, 116u, 0u, 0u, 0u, 111u, 0u, 0u,
+    3u, 0u, 214u, 216u, 1u, 0u, 0u, 0u, 4u, 0u, 213u, 0u,
+    0u, 44u, 0u, 0u, 5u, 0u, 0u, 0u, 7u, 0u, 53u, 0u,
+    5u, 0u, 0u, 0u, 0u, 110u, 0u, 0u, 0u, 111u, 0u, 0u,
+    0u, 119u, 0u, 0u, 1u, 0u, 0u, 0u, 3u, 0u, 223u, 225u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 97u, 0u, 0u,
+    0u, 116u, 0u, 0u, 3u, 0u, 230u, 232u, 1u, 0u, 0u, 0u,
+    4u, 0u, 229u, 0u, 0u, 44u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 55u, 0u, 5u, 0u, 0u, 0u, 3u, 0u, 237u, 241u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 101u, 0u, 0u,
+    4u, 0u, 272u, 0u, 3u, 0u, 242u, 244u, 0u, 97u, 0u, 0u,
+    4u, 0u, 272u, 0u, 3u, 0u, 245u, 248u, 0u, 97u, 0u, 0u,
+    0u, 110u, 0u, 0u, 4u, 0u, 272u, 0u, 3u, 0u, 249u, 254u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 105u, 0u, 0u,
+    0u, 115u, 0u, 0u, 4u, 0u, 272u, 0u, 3u, 0u, 255u, 260u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 97u, 0u, 0u,
+    0u, 116u, 0u, 0u, 4u, 0u, 272u, 0u, 3u, 0u, 261u, 267u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 101u, 0u, 0u,
+    0u, 115u, 0u, 0u, 0u, 101u, 0u, 0u, 4u, 0u, 272u, 0u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 111u, 0u, 0u,
+    0u, 115u, 0u, 0u, 0u, 101u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 272u, 274u, 0u, 99u, 0u, 0u, 0u, 111u, 0u, 0u,
+    0u, 110u, 0u, 0u, 0u, 115u, 0u, 0u, 0u, 101u, 0u, 0u,
+    0u, 113u, 0u, 0u, 0u, 117u, 0u, 0u, 0u, 101u, 0u, 0u,
+    0u, 110u, 0u, 0u, 0u, 99u, 0u, 0u, 0u, 101u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 285u, 287u, 0u, 111u, 0u, 0u,
+    0u, 102u, 0u, 0u, 5u, 0u, 0u, 0u, 7u, 0u, 61u, 0u,
+    5u, 0u, 0u, 0u, 0u, 105u, 0u, 0u, 0u, 115u, 0u, 0u,
+    5u, 0u, 0u, 0u, 7u, 0u, 61u, 0u, 5u, 0u, 0u, 0u,
+    3u, 0u, 298u, 302u, 0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u,
+    0u, 101u, 0u, 0u, 4u, 0u, 333u, 0u, 3u, 0u, 303u, 305u,
+    0u, 97u, 0u, 0u, 4u, 0u, 333u, 0u, 3u, 0u, 306u, 309u,
+    0u, 97u, 0u, 0u, 0u, 110u, 0u, 0u, 4u, 0u, 333u, 0u,
+    3u, 0u, 310u, 315u, 0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u,
+    0u, 105u, 0u, 0u, 0u, 115u, 0u, 0u, 4u, 0u, 333u, 0u,
+    3u, 0u, 316u, 321u, 0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u,
+    0u, 97u, 0u, 0u, 0u, 116u, 0u, 0u, 4u, 0u, 333u, 0u,
+    3u, 0u, 322u, 328u, 0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u,
+    0u, 101u, 0u, 0u, 0u, 115u, 0u, 0u, 0u, 101u, 0u, 0u,
+    4u, 0u, 333u, 0u, 0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u,
+    0u, 111u, 0u, 0u, 0u, 115u, 0u, 0u, 0u, 101u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 333u, 335u, 0u, 101u, 0u, 0u,
+    0u, 102u, 0u, 0u, 0u, 102u, 0u, 0u, 0u, 101u, 0u, 0u,
+    0u, 99u, 0u, 0u, 0u, 116u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 341u, 343u, 0u, 111u, 0u, 0u, 0u, 102u, 0u, 0u,
+    5u, 0u, 0u, 0u, 7u, 0u, 62u, 0u, 5u, 0u, 0u, 0u,
+    0u, 105u, 0u, 0u, 0u, 115u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 62u, 0u, 5u, 0u, 0u, 0u, 0u, 116u, 0u, 0u,
+    0u, 104u, 0u, 0u, 0u, 101u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 356u, 358u, 0u, 105u, 0u, 0u, 0u, 109u, 0u, 0u,
+    0u, 112u, 0u, 0u, 0u, 108u, 0u, 0u, 0u, 105u, 0u, 0u,
+    0u, 99u, 0u, 0u, 0u, 97u, 0u, 0u, 0u, 116u, 0u, 0u,
+    0u, 105u, 0u, 0u, 0u, 111u, 0u, 0u, 0u, 110u, 0u, 0u,
+    0u, 115u, 0u, 0u, 1u, 0u, 0u, 0u, 3u, 0u, 370u, 372u,
+    0u, 111u, 0u, 0u, 0u, 102u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 64u, 0u, 5u, 0u, 0u, 0u, 0u, 97u, 0u, 0u,
+    0u, 114u, 0u, 0u, 0u, 101u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 64u, 0u, 5u, 0u, 0u, 0u, 3u, 0u, 384u, 388u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 101u, 0u, 0u,
+    4u, 0u, 419u, 0u, 3u, 0u, 389u, 391u, 0u, 97u, 0u, 0u,
+    4u, 0u, 419u, 0u, 3u, 0u, 392u, 395u, 0u, 97u, 0u, 0u,
+    0u, 110u, 0u, 0u, 4u, 0u, 419u, 0u, 3u, 0u, 396u, 401u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 105u, 0u, 0u,
+    0u, 115u, 0u, 0u, 4u, 0u, 419u, 0u, 3u, 0u, 402u, 407u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 97u, 0u, 0u,
+    0u, 116u, 0u, 0u, 4u, 0u, 419u, 0u, 3u, 0u, 408u, 414u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 101u, 0u, 0u,
+    0u, 115u, 0u, 0u, 0u, 101u, 0u, 0u, 4u, 0u, 419u, 0u,
+    0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u, 0u, 111u, 0u, 0u,
+    0u, 115u, 0u, 0u, 0u, 101u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 419u, 421u, 0u, 114u, 0u, 0u, 0u, 101u, 0u, 0u,
+    0u, 97u, 0u, 0u, 0u, 115u, 0u, 0u, 0u, 111u, 0u, 0u,
+    0u, 110u, 0u, 0u, 3u, 0u, 428u, 434u, 1u, 0u, 0u, 0u,
+    3u, 0u, 428u, 430u, 0u, 116u, 0u, 0u, 0u, 104u, 0u, 0u,
+    0u, 97u, 0u, 0u, 0u, 116u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 67u, 0u, 5u, 0u, 0u, 0u, 0u, 105u, 0u, 0u,
+    0u, 115u, 0u, 0u, 5u, 0u, 0u, 0u, 7u, 0u, 67u, 0u,
+    5u, 0u, 0u, 0u, 3u, 0u, 443u, 447u, 0u, 116u, 0u, 0u,
+    0u, 104u, 0u, 0u, 0u, 101u, 0u, 0u, 4u, 0u, 478u, 0u,
+    3u, 0u, 448u, 450u, 0u, 97u, 0u, 0u, 4u, 0u, 478u, 0u,
+    3u, 0u, 451u, 454u, 0u, 97u, 0u, 0u, 0u, 110u, 0u, 0u,
+    4u, 0u, 478u, 0u, 3u, 0u, 455u, 460u, 0u, 116u, 0u, 0u,
+    0u, 104u, 0u, 0u, 0u, 105u, 0u, 0u, 0u, 115u, 0u, 0u,
+    4u, 0u, 478u, 0u, 3u, 0u, 461u, 466u, 0u, 116u, 0u, 0u,
+    0u, 104u, 0u, 0u, 0u, 97u, 0u, 0u, 0u, 116u, 0u, 0u,
+    4u, 0u, 478u, 0u, 3u, 0u, 467u, 473u, 0u, 116u, 0u, 0u,
+    0u, 104u, 0u, 0u, 0u, 101u, 0u, 0u, 0u, 115u, 0u, 0u,
+    0u, 101u, 0u, 0u, 4u, 0u, 478u, 0u, 0u, 116u, 0u, 0u,
+    0u, 104u, 0u, 0u, 0u, 111u, 0u, 0u, 0u, 115u, 0u, 0u,
+    0u, 101u, 0u, 0u, 1u, 0u, 0u, 0u, 3u, 0u, 478u, 480u,
+    0u, 114u, 0u, 0u, 0u, 101u, 0u, 0u, 0u, 97u, 0u, 0u,
+    0u, 115u, 0u, 0u, 0u, 111u, 0u, 0u, 0u, 110u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 486u, 488u, 0u, 102u, 0u, 0u,
+    0u, 111u, 0u, 0u, 0u, 114u, 0u, 0u, 5u, 0u, 0u, 0u,
+    7u, 0u, 68u, 0u, 5u, 0u, 0u, 0u, 0u, 105u, 0u, 0u,
+    0u, 115u, 0u, 0u, 5u, 0u, 0u, 0u, 7u, 0u, 68u, 0u,
+    5u, 0u, 0u, 0u, 0u, 105u, 0u, 0u, 0u, 110u, 0u, 0u,
+    1u, 0u, 0u, 0u, 3u, 0u, 501u, 503u, 0u, 108u, 0u, 0u,
+    0u, 105u, 0u, 0u, 0u, 103u, 0u, 0u, 0u, 104u, 0u, 0u,
+    0u, 116u, 0u, 0u, 1u, 0u, 0u, 0u, 3u, 0u, 508u, 510u,
+    0u, 111u, 0u, 0u, 0u, 102u, 0u, 0u, 3u, 0u, 513u, 515u,
+    1u, 0u, 0u, 0u, 4u, 0u, 512u, 0u, 0u, 44u, 0u, 0u,
+    5u, 0u, 0u, 0u, 7u, 0u, 76u, 0u
+}};
+
+constexpr std::array<uint32_t, 460> patterns = {{
+    4294967294u, 4294967295u, 0u, 0u, 0u, 0u, 4294967295u, 0u, 0u, 1u, 13u, 4294967295u,
+    0u, 0u, 0u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u,
+    1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u,
+    4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u,
+    0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u,
+    4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u,
+    0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u,
+    1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 21u, 4294967295u, 0u, 0u, 1u, 30u,
+    4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 0u, 4294967294u, 4294967295u, 0u,
+    0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u,
+    4294967294u, 4294967295u, 0u, 0u, 0u, 4294967294u, 4294967295u, 0u, 0u, 0u, 4294967294u, 4294967295u,
+    0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u,
+    1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u,
+    4294967295u, 0u, 0u, 1u, 43u, 4294967295u, 0u, 0u, 1u, 54u, 4294967295u, 0u,
+    0u, 1u, 65u, 4294967295u, 0u, 0u, 1u, 80u, 101u, 10u, 0u, 1u,
+    4294967294u, 4294967295u, 0u, 0u, 0u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u,
+    0u, 0u, 0u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u,
+    1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u,
+    4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 106u, 4294967295u, 0u,
+    0u, 1u, 130u, 4294967295u, 0u, 0u, 1u, 142u, 4294967295u, 0u, 0u, 1u,
+    4294967294u, 4294967295u, 0u, 0u, 1u, 158u, 4294967295u, 0u, 0u, 1u, 166u, 4294967295u,
+    0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 181u, 4294967295u, 0u, 0u,
+    1u, 193u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 219u,
+    4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 0u, 4294967294u, 4294967295u, 0u,
+    0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 0u, 4294967294u, 4294967295u, 0u, 0u, 1u,
+    4294967294u, 4294967295u, 0u, 1u, 1u, 235u, 291u, 10u, 0u, 1u, 296u, 347u,
+    10u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 352u, 376u, 10u, 0u,
+    1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 382u,
+    436u, 10u, 0u, 1u, 441u, 493u, 10u, 1u, 1u, 4294967294u, 4294967295u, 0u,
+    0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u,
+    4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 1u, 1u, 4294967294u, 4294967295u,
+    0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 498u, 4294967295u, 0u, 0u,
+    1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u,
+    4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u,
+    0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u,
+    4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u,
+    0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u, 4294967295u, 0u, 0u,
+    0u, 4294967294u, 4294967295u, 0u, 0u, 0u, 4294967294u, 4294967295u, 0u, 0u, 1u, 4294967294u,
+    4294967295u, 0u, 1u, 1u
+}};
+
+constexpr std::array<uint64_t, 736> firstBytes = {{
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000010000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000100000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000020000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0008000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000800000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000100000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000100000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0010000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000100000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0800000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0800000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000100000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000100000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000008000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000400000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0010000200000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000020000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0010000200000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0010000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000200000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0010000200000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000020000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0010000200000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000020000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull
+}};
+
+constexpr std::array<const char*, 98> literals = {{
+    "where", "having", "as", "arise", "arisen", "arises", "arising", "arose", "bring", "bringing", "brings", "brought",
+    "creat", "produc", "engender", "generat", "rise", "incit", "launch", "off", "from", "trigger", "spark", "precipitat",
+    "eliminat", "if", "should", "had", "allow", "compel", "forc", "let", "made", "make", "makes", "making",
+    "oblig", "permit", "requir", "forb", "prevent", "prohibit", "once", "since", "then", "aftermath", "takes", "after",
+    "follow", "conditioned", "contingent", "critical", "essential", "responsible", "vital", "consequently,", "hence,", "therefore,", "why", "so",
+    "thus", "because", "given", "attempt", "lest", "that", "thanks", "else", "unless", "cause", "consequence", "effect",
+    "grounds", "implications", "the", "necessary", "reason", "result", "condition", "sake", "light", "ensur", "guarantee", "certain",
+    "assur", "attribut", "blam", "caus", "contribut", "depend", "drive", "driven", "drives", "driving", "drove", "eas",
+    "enabl", "probable"
+}};
+
+constexpr std::array<uint32_t, 93> literalOffsets = {{
+    0u, 1u, 2u, 3u, 8u, 12u, 13u, 14u, 15u, 16u, 17u, 18u,
+    19u, 20u, 21u, 22u, 23u, 24u, 25u, 26u, 27u, 28u, 29u, 30u,
+    31u, 32u, 36u, 37u, 38u, 39u, 40u, 41u, 42u, 43u, 44u, 45u,
+    46u, 47u, 48u, 49u, 50u, 51u, 52u, 53u, 54u, 55u, 56u, 57u,
+    58u, 59u, 60u, 61u, 62u, 63u, 64u, 65u, 66u, 67u, 68u, 69u,
+    70u, 71u, 72u, 73u, 74u, 75u, 76u, 77u, 78u, 79u, 80u, 81u,
+    82u, 83u, 84u, 85u, 86u, 87u, 88u, 89u, 90u, 91u, 92u, 93u,
+    97u, 98u, 99u, 100u, 101u, 106u, 107u, 108u, 109u
+}};
+
+constexpr std::array<uint32_t, 109> literalIndices = {{
+    0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u,
+    12u, 13u, 14u, 15u, 16u, 17u, 18u, 19u, 20u, 21u, 22u, 23u,
+    24u, 25u, 26u, 27u, 28u, 29u, 30u, 31u, 32u, 33u, 34u, 35u,
+    36u, 37u, 38u, 39u, 40u, 41u, 42u, 43u, 44u, 45u, 46u, 47u,
+    48u, 49u, 50u, 51u, 52u, 53u, 54u, 55u, 56u, 57u, 58u, 59u,
+    60u, 61u, 62u, 63u, 64u, 65u, 59u, 66u, 67u, 68u, 69u, 70u,
+    71u, 72u, 73u, 74u, 75u, 76u, 76u, 76u, 76u, 77u, 78u, 61u,
+    76u, 79u, 80u, 81u, 82u, 83u, 84u, 85u, 86u, 8u, 9u, 10u,
+    11u, 87u, 20u, 88u, 89u, 90u, 91u, 92u, 93u, 94u, 95u, 96u,
+    97u
+}};
+
+constexpr std::array<uint32_t, 1304> trie = {{
+    0u, 171u, 0u, 0u, 171u, 171u, 0u, 1u, 171u, 172u, 1u, 1u,
+    172u, 172u, 1u, 2u, 172u, 173u, 2u, 2u, 173u, 173u, 2u, 3u,
+    173u, 174u, 3u, 3u, 174u, 174u, 3u, 4u, 174u, 175u, 4u, 4u,
+    175u, 175u, 4u, 5u, 175u, 176u, 5u, 5u, 176u, 176u, 5u, 6u,
+    176u, 178u, 6u, 6u, 178u, 178u, 6u, 7u, 178u, 180u, 7u, 7u,
+    180u, 180u, 7u, 8u, 180u, 182u, 8u, 8u, 182u, 182u, 8u, 9u,
+    182u, 184u, 9u, 9u, 184u, 184u, 9u, 10u, 184u, 184u, 10u, 11u,
+    184u, 184u, 11u, 12u, 184u, 184u, 12u, 13u, 184u, 184u, 13u, 14u,
+    184u, 184u, 14u, 15u, 184u, 184u, 15u, 16u, 184u, 184u, 16u, 17u,
+    184u, 184u, 17u, 18u, 184u, 184u, 18u, 19u, 184u, 184u, 19u, 20u,
+    184u, 184u, 20u, 21u, 184u, 184u, 21u, 22u, 184u, 184u, 22u, 23u,
+    184u, 184u, 23u, 24u, 184u, 184u, 24u, 25u, 184u, 184u, 25u, 26u,
+    184u, 185u, 26u, 26u, 185u, 186u, 26u, 26u, 186u, 186u, 26u, 27u,
+    186u, 187u, 27u, 27u, 187u, 188u, 27u, 27u, 188u, 188u, 27u, 28u,
+    188u, 189u, 28u, 28u, 189u, 190u, 28u, 28u, 190u, 190u, 28u, 29u,
+    190u, 191u, 29u, 29u, 191u, 192u, 29u, 29u, 192u, 192u, 29u, 30u,
+    192u, 193u, 30u, 30u, 193u, 194u, 30u, 30u, 194u, 194u, 30u, 31u,
+    194u, 194u, 31u, 32u, 194u, 194u, 32u, 33u, 194u, 194u, 33u, 34u,
+    194u, 194u, 34u, 35u, 194u, 194u, 35u, 36u, 194u, 194u, 36u, 37u,
+    194u, 194u, 37u, 38u, 194u, 194u, 38u, 39u, 194u, 195u, 39u, 39u,
+    195u, 195u, 39u, 40u, 195u, 196u, 40u, 40u, 196u, 196u, 40u, 41u,
+    196u, 197u, 41u, 41u, 197u, 197u, 41u, 42u, 197u, 198u, 42u, 42u,
+    198u, 198u, 42u, 43u, 198u, 199u, 43u, 43u, 199u, 199u, 43u, 44u,
+    199u, 200u, 44u, 44u, 200u, 200u, 44u, 45u, 200u, 201u, 45u, 45u,
+    201u, 201u, 45u, 46u, 201u, 201u, 46u, 47u, 201u, 201u, 47u, 48u,
+    201u, 201u, 48u, 49u, 201u, 201u, 49u, 50u, 201u, 201u, 50u, 51u,
+    201u, 201u, 51u, 52u, 201u, 201u, 52u, 53u, 201u, 201u, 53u, 54u,
+    201u, 201u, 54u, 55u, 201u, 201u, 55u, 56u, 201u, 201u, 56u, 57u,
+    201u, 201u, 57u, 58u, 201u, 201u, 58u, 59u, 201u, 201u, 59u, 60u,
+    201u, 201u, 60u, 61u, 201u, 201u, 61u, 62u, 201u, 201u, 62u, 63u,
+    201u, 201u, 63u, 64u, 201u, 201u, 64u, 65u, 201u, 201u, 65u, 66u,
+    201u, 201u, 66u, 67u, 201u, 202u, 67u, 67u, 202u, 202u, 67u, 68u,
+    202u, 203u, 68u, 68u, 203u, 203u, 68u, 69u, 203u, 204u, 69u, 69u,
+    204u, 204u, 69u, 70u, 204u, 205u, 70u, 70u, 205u, 205u, 70u, 71u,
+    205u, 205u, 71u, 72u, 205u, 205u, 72u, 73u, 205u, 205u, 73u, 74u,
+    205u, 205u, 74u, 75u, 205u, 205u, 75u, 76u, 205u, 205u, 76u, 77u,
+    205u, 205u, 77u, 78u, 205u, 206u, 78u, 79u, 206u, 207u, 79u, 80u,
+    207u, 208u, 80u, 81u, 208u, 209u, 81u, 82u, 209u, 210u, 82u, 82u,
+    210u, 210u, 82u, 83u, 210u, 211u, 83u, 83u, 211u, 211u, 83u, 84u,
+    211u, 212u, 84u, 84u, 212u, 212u, 84u, 85u, 212u, 213u, 85u, 85u,
+    213u, 213u, 85u, 86u, 213u, 213u, 86u, 87u, 213u, 213u, 87u, 88u,
+    213u, 213u, 88u, 89u, 213u, 213u, 89u, 90u, 213u, 213u, 90u, 91u,
+    213u, 213u, 91u, 92u, 213u, 213u, 92u, 93u, 213u, 213u, 93u, 94u,
+    213u, 213u, 94u, 95u, 213u, 213u, 95u, 96u, 213u, 213u, 96u, 97u,
+    213u, 213u, 97u, 98u, 213u, 213u, 98u, 99u, 213u, 213u, 99u, 100u,
+    213u, 213u, 100u, 101u, 213u, 213u, 101u, 102u, 213u, 213u, 102u, 103u,
+    213u, 213u, 103u, 104u, 213u, 213u, 104u, 105u, 213u, 213u, 105u, 106u,
+    213u, 213u, 106u, 107u, 213u, 213u, 107u, 108u, 213u, 215u, 108u, 108u,
+    215u, 215u, 108u, 109u, 215u, 217u, 109u, 109u, 217u, 217u, 109u, 110u,
+    217u, 219u, 110u, 110u, 219u, 219u, 110u, 111u, 219u, 221u, 111u, 111u,
+    221u, 221u, 111u, 112u, 221u, 221u, 112u, 113u, 221u, 221u, 113u, 114u,
+    221u, 221u, 114u, 115u, 221u, 221u, 115u, 116u, 221u, 238u, 116u, 116u,
+    238u, 239u, 116u, 116u, 239u, 239u, 116u, 117u, 239u, 240u, 117u, 117u,
+    240u, 240u, 117u, 118u, 240u, 241u, 118u, 118u, 241u, 241u, 118u, 119u,
+    241u, 242u, 119u, 119u, 242u, 242u, 119u, 120u, 242u, 243u, 120u, 120u,
+    243u, 243u, 120u, 121u, 243u, 244u, 121u, 121u, 244u, 244u, 121u, 122u,
+    244u, 244u, 122u, 123u, 244u, 245u, 123u, 124u, 245u, 245u, 124u, 125u,
+    245u, 245u, 125u, 126u, 245u, 246u, 126u, 126u, 246u, 246u, 126u, 127u,
+    246u, 246u, 127u, 128u, 246u, 246u, 128u, 129u, 246u, 250u, 129u, 129u,
+    250u, 251u, 129u, 129u, 251u, 251u, 129u, 130u, 251u, 254u, 130u, 130u,
+    254u, 255u, 130u, 130u, 255u, 255u, 130u, 131u, 255u, 258u, 131u, 131u,
+    258u, 259u, 131u, 131u, 259u, 259u, 131u, 132u, 259u, 262u, 132u, 132u,
+    262u, 263u, 132u, 132u, 263u, 263u, 132u, 133u, 263u, 266u, 133u, 133u,
+    266u, 267u, 133u, 133u, 267u, 267u, 133u, 134u, 267u, 270u, 134u, 134u,
+    270u, 271u, 134u, 134u, 271u, 271u, 134u, 135u, 271u, 274u, 135u, 135u,
+    274u, 275u, 135u, 135u, 275u, 275u, 135u, 136u, 275u, 276u, 136u, 136u,
+    276u, 276u, 136u, 137u, 276u, 277u, 137u, 137u, 277u, 277u, 137u, 138u,
+    277u, 278u, 138u, 138u, 278u, 279u, 138u, 138u, 279u, 279u, 138u, 139u,
+    279u, 280u, 139u, 139u, 280u, 281u, 139u, 139u, 281u, 281u, 139u, 140u,
+    281u, 282u, 140u, 140u, 282u, 283u, 140u, 140u, 283u, 283u, 140u, 141u,
+    283u, 284u, 141u, 141u, 284u, 285u, 141u, 141u, 285u, 285u, 141u, 142u,
+    285u, 286u, 142u, 142u, 286u, 287u, 142u, 142u, 287u, 287u, 142u, 143u,
+    287u, 288u, 143u, 143u, 288u, 289u, 143u, 143u, 289u, 289u, 143u, 144u,
+    289u, 290u, 144u, 144u, 290u, 291u, 144u, 144u, 291u, 291u, 144u, 145u,
+    291u, 293u, 145u, 145u, 293u, 293u, 145u, 146u, 293u, 293u, 146u, 147u,
+    293u, 294u, 147u, 147u, 294u, 294u, 147u, 148u, 294u, 295u, 148u, 148u,
+    295u, 295u, 148u, 149u, 295u, 296u, 149u, 149u, 296u, 296u, 149u, 150u,
+    296u, 297u, 150u, 150u, 297u, 297u, 150u, 151u, 297u, 298u, 151u, 151u,
+    298u, 298u, 151u, 152u, 298u, 299u, 152u, 152u, 299u, 299u, 152u, 153u,
+    299u, 300u, 153u, 153u, 300u, 300u, 153u, 154u, 300u, 301u, 154u, 154u,
+    301u, 301u, 154u, 155u, 301u, 301u, 155u, 156u, 301u, 302u, 156u, 156u,
+    302u, 303u, 156u, 156u, 303u, 303u, 156u, 157u, 303u, 304u, 157u, 157u,
+    304u, 305u, 157u, 157u, 305u, 306u, 157u, 157u, 306u, 306u, 157u, 158u,
+    306u, 306u, 158u, 159u, 306u, 306u, 159u, 160u, 306u, 306u, 160u, 161u,
+    306u, 306u, 161u, 162u, 306u, 306u, 162u, 163u, 306u, 306u, 163u, 164u,
+    306u, 306u, 164u, 165u, 306u, 306u, 165u, 166u, 306u, 306u, 166u, 167u,
+    306u, 306u, 167u, 168u, 306u, 306u, 168u, 169u, 306u, 306u, 169u, 170u,
+    306u, 306u, 170u, 171u, 306u, 306u, 171u, 172u, 306u, 306u, 172u, 173u,
+    306u, 306u, 173u, 174u, 306u, 307u, 174u, 174u, 307u, 307u, 174u, 175u,
+    307u, 308u, 175u, 175u, 308u, 308u, 175u, 176u, 308u, 309u, 176u, 176u,
+    309u, 309u, 176u, 177u, 309u, 310u, 177u, 177u, 310u, 310u, 177u, 178u,
+    310u, 311u, 178u, 178u, 311u, 311u, 178u, 179u, 311u, 312u, 179u, 179u,
+    312u, 312u, 179u, 180u, 312u, 313u, 180u, 180u, 313u, 313u, 180u, 181u,
+    313u, 314u, 181u, 181u, 314u, 314u, 181u, 182u, 314u, 314u, 182u, 183u,
+    314u, 314u, 183u, 184u, 314u, 314u, 184u, 185u, 314u, 314u, 185u, 186u,
+    314u, 314u, 186u, 187u, 314u, 314u, 187u, 188u, 314u, 314u, 188u, 189u,
+    314u, 314u, 189u, 190u, 314u, 314u, 190u, 191u, 314u, 314u, 191u, 192u,
+    314u, 314u, 192u, 193u, 314u, 314u, 193u, 194u, 314u, 315u, 194u, 194u,
+    315u, 315u, 194u, 195u, 315u, 316u, 195u, 195u, 316u, 316u, 195u, 196u,
+    316u, 317u, 196u, 196u, 317u, 317u, 196u, 197u, 317u, 318u, 197u, 197u,
+    318u, 318u, 197u, 198u, 318u, 319u, 198u, 198u, 319u, 319u, 198u, 199u,
+    319u, 320u, 199u, 199u, 320u, 320u, 199u, 200u, 320u, 321u, 200u, 200u,
+    321u, 321u, 200u, 201u, 321u, 322u, 201u, 201u, 322u, 322u, 201u, 202u,
+    322u, 322u, 202u, 203u, 322u, 322u, 203u, 204u, 322u, 322u, 204u, 205u,
+    322u, 322u, 205u, 206u, 322u, 322u, 206u, 207u, 322u, 322u, 207u, 208u,
+    322u, 322u, 208u, 209u, 322u, 322u, 209u, 210u, 322u, 322u, 210u, 211u,
+    322u, 322u, 211u, 212u, 322u, 322u, 212u, 213u, 322u, 322u, 213u, 214u,
+    322u, 322u, 214u, 215u, 322u, 323u, 215u, 215u, 323u, 324u, 215u, 215u,
+    324u, 325u, 215u, 215u, 325u, 325u, 215u, 216u
+}};
+
+constexpr std::array<uint32_t, 325> trieEdges = {{
+    90u, 92u, 93u, 91u, 2u, 8u, 4u, 10u, 6u, 261u, 263u, 262u,
+    264u, 265u, 269u, 267u, 271u, 169u, 273u, 277u, 275u, 279u, 12u, 18u,
+    14u, 16u, 242u, 147u, 285u, 287u, 286u, 288u, 143u, 145u, 149u, 94u,
+    98u, 100u, 96u, 293u, 297u, 295u, 299u, 20u, 22u, 21u, 23u, 301u,
+    305u, 307u, 303u, 309u, 312u, 310u, 313u, 311u, 314u, 316u, 315u, 317u,
+    85u, 87u, 86u, 88u, 174u, 318u, 320u, 319u, 321u, 28u, 30u, 31u,
+    29u, 249u, 251u, 250u, 252u, 151u, 153u, 154u, 152u, 245u, 131u, 129u,
+    132u, 133u, 130u, 102u, 104u, 103u, 105u, 42u, 32u, 34u, 33u, 35u,
+    36u, 45u, 39u, 48u, 253u, 255u, 256u, 254u, 89u, 51u, 53u, 52u,
+    54u, 155u, 55u, 57u, 56u, 58u, 170u, 106u, 107u, 108u, 111u, 109u,
+    110u, 112u, 113u, 117u, 115u, 119u, 121u, 122u, 123u, 124u, 81u, 83u,
+    82u, 84u, 134u, 136u, 137u, 135u, 24u, 26u, 25u, 27u, 138u, 140u,
+    141u, 139u, 125u, 127u, 126u, 128u, 59u, 61u, 63u, 171u, 77u, 79u,
+    80u, 78u, 65u, 69u, 71u, 67u, 142u, 172u, 322u, 73u, 75u, 76u,
+    74u, 175u, 1u, 3u, 5u, 7u, 9u, 11u, 13u, 281u, 15u, 282u,
+    17u, 283u, 19u, 284u, 37u, 38u, 40u, 41u, 43u, 44u, 46u, 47u,
+    49u, 50u, 60u, 62u, 64u, 66u, 68u, 70u, 72u, 95u, 97u, 99u,
+    101u, 257u, 258u, 259u, 260u, 114u, 116u, 118u, 120u, 144u, 289u, 146u,
+    290u, 148u, 291u, 150u, 292u, 179u, 182u, 239u, 156u, 158u, 160u, 162u,
+    197u, 222u, 164u, 188u, 176u, 191u, 185u, 194u, 166u, 168u, 157u, 159u,
+    161u, 163u, 165u, 167u, 241u, 173u, 177u, 199u, 201u, 225u, 178u, 180u,
+    204u, 227u, 181u, 183u, 207u, 229u, 184u, 186u, 210u, 231u, 187u, 189u,
+    213u, 233u, 190u, 192u, 216u, 235u, 193u, 195u, 219u, 237u, 196u, 198u,
+    200u, 202u, 203u, 205u, 206u, 208u, 209u, 211u, 212u, 214u, 215u, 217u,
+    218u, 220u, 221u, 223u, 224u, 226u, 228u, 230u, 232u, 234u, 236u, 238u,
+    240u, 243u, 244u, 246u, 247u, 248u, 266u, 268u, 270u, 272u, 274u, 276u,
+    278u, 280u, 294u, 296u, 298u, 300u, 302u, 304u, 306u, 308u, 323u, 324u,
+    325u
+}};
+
+constexpr std::array<const char*, 325> trieWords = {{
+    "allow", "allowed", "allowing", "allows", "arise", "arisen", "arises", "arising", "arose", "assure", "assured", "assures",
+    "assuring", "attribute", "attributed", "attributes", "attributing", "because", "blame", "blamed", "blames", "blaming", "bring", "bringing",
+    "brings", "brought", "by", "came", "cause", "caused", "causes", "causing", "come", "comes", "coming", "compel",
+    "compelled", "compelling", "compels", "contribute", "contributed", "contributes", "contributing", "create", "created", "creates", "creating", "depend",
+    "depended", "depending", "depends", "drive", "driven", "drives", "driving", "drove", "ease", "eased", "eases", "easing",
+    "eliminate", "eliminated", "eliminates", "eliminating", "else", "enable", "enabled", "enables", "enabling", "engender", "engendered", "engendering",
+    "engenders", "ensure", "ensured", "ensures", "ensuring", "follow", "followed", "following", "follows", "for", "forbade", "forbid",
+    "forbidden", "forbidding", "forbids", "force", "forced", "forces", "forcing", "gave", "generate", "generated", "generates", "generating",
+    "give", "given", "gives", "giving", "guarantee", "guaranteed", "guaranteeing", "guarantees", "had", "incite", "incited", "incites",
+    "inciting", "is", "launch", "launched", "launches", "launching", "lest", "let", "lets", "letting", "made", "make",
+    "makes", "making", "oblige", "obliged", "obliges", "obliging", "permit", "permits", "permitted", "permitting", "precipitate", "precipitated",
+    "precipitates", "precipitating", "prevent", "prevented", "preventing", "prevents", "produce", "produced", "produces", "producing", "prohibit", "prohibited",
+    "prohibiting", "prohibits", "require", "required", "requires", "requiring", "set", "sets", "setting", "so", "spark", "sparked",
+    "sparking", "sparks", "stem", "stemmed", "stemming", "stems", "takes", "thanks", "the", "trigger", "triggered", "triggering",
+    "triggers", "unless", "where", "from", "from", "from", "from", "from", "on", "to", "on", "to",
+    "on", "to", "on", "to", "rise", "to", "rise", "to", "rise", "to", "rise", "to",
+    "rise", "to", "off", "off", "off", "from", "from", "from", "from", "to", "to", "to",
+    "to", "certain", "certain", "certain", "certain", "to", "to", "to", "to", "after", "from", "after",
+    "from", "after", "from", "after", "from", "a", "an", "condition", "conditioned", "contingent", "critical", "essential",
+    "grounds", "reason", "responsible", "that", "the", "these", "this", "those", "vital", "why", "on", "on",
+    "to", "to", "for", "to", "of", "to", "cause", "key", "necessary", "result", "of", "cause",
+    "necessary", "result", "of", "cause", "necessary", "result", "of", "cause", "necessary", "result", "of", "cause",
+    "necessary", "result", "of", "cause", "necessary", "result", "of", "cause", "necessary", "result", "of", "for",
+    "to", "condition", "of", "condition", "of", "condition", "of", "condition", "of", "condition", "of", "condition",
+    "of", "condition", "of", "to", "why", "of", "of", "of", "of", "of", "of", "of",
+    "of", "reason", "of", "the", "sake", "of", "to", "to", "to", "to", "for", "for",
+    "for", "for", "to", "to", "to", "to", "on", "on", "on", "on", "probable", "cause",
+    "of"
+}};
+
+constexpr std::array<uint32_t, 432> trieTerminals = {{
+    0u, 0u, 3u, 0u, 3u, 1u, 3u, 2u, 3u, 3u, 3u, 4u,
+    4u, 0u, 4u, 1u, 4u, 2u, 4u, 3u, 5u, 0u, 5u, 1u,
+    5u, 2u, 5u, 3u, 6u, 0u, 6u, 1u, 6u, 2u, 6u, 3u,
+    7u, 0u, 7u, 1u, 7u, 2u, 7u, 3u, 8u, 0u, 8u, 1u,
+    8u, 2u, 8u, 3u, 9u, 0u, 9u, 1u, 9u, 2u, 9u, 3u,
+    9u, 4u, 10u, 0u, 10u, 1u, 10u, 2u, 10u, 3u, 11u, 0u,
+    11u, 1u, 11u, 2u, 11u, 3u, 12u, 0u, 12u, 1u, 12u, 2u,
+    13u, 0u, 13u, 1u, 13u, 2u, 13u, 3u, 14u, 0u, 14u, 1u,
+    14u, 2u, 14u, 3u, 15u, 0u, 15u, 1u, 15u, 2u, 15u, 3u,
+    16u, 0u, 16u, 1u, 16u, 2u, 16u, 3u, 17u, 0u, 17u, 1u,
+    17u, 2u, 17u, 3u, 20u, 0u, 21u, 0u, 21u, 1u, 21u, 2u,
+    21u, 3u, 22u, 0u, 22u, 1u, 22u, 2u, 22u, 3u, 23u, 0u,
+    23u, 1u, 23u, 2u, 23u, 3u, 24u, 0u, 24u, 1u, 24u, 2u,
+    25u, 0u, 25u, 1u, 25u, 2u, 25u, 3u, 26u, 0u, 26u, 1u,
+    26u, 2u, 26u, 3u, 27u, 0u, 27u, 1u, 27u, 2u, 27u, 3u,
+    28u, 0u, 28u, 1u, 28u, 2u, 28u, 3u, 29u, 0u, 29u, 1u,
+    29u, 2u, 29u, 3u, 29u, 4u, 30u, 0u, 30u, 1u, 30u, 2u,
+    30u, 3u, 31u, 0u, 31u, 1u, 31u, 2u, 31u, 3u, 36u, 0u,
+    37u, 0u, 37u, 1u, 37u, 2u, 37u, 3u, 38u, 0u, 38u, 1u,
+    38u, 2u, 38u, 3u, 39u, 0u, 40u, 0u, 41u, 0u, 42u, 0u,
+    43u, 0u, 44u, 0u, 48u, 0u, 51u, 0u, 54u, 0u, 56u, 0u,
+    57u, 0u, 58u, 0u, 59u, 0u, 60u, 0u, 60u, 1u, 60u, 2u,
+    60u, 3u, 60u, 4u, 60u, 5u, 60u, 6u, 63u, 0u, 65u, 0u,
+    66u, 0u, 66u, 1u, 66u, 2u, 66u, 3u, 66u, 4u, 66u, 5u,
+    66u, 6u, 69u, 0u, 70u, 0u, 71u, 0u, 71u, 1u, 71u, 2u,
+    71u, 3u, 71u, 4u, 71u, 5u, 71u, 6u, 72u, 0u, 73u, 0u,
+    74u, 0u, 75u, 0u, 77u, 0u, 77u, 1u, 77u, 2u, 77u, 3u,
+    78u, 0u, 78u, 1u, 78u, 2u, 78u, 3u, 79u, 0u, 79u, 1u,
+    79u, 2u, 79u, 3u, 80u, 0u, 80u, 1u, 80u, 2u, 80u, 3u,
+    81u, 0u, 81u, 1u, 81u, 2u, 81u, 3u, 82u, 0u, 82u, 1u,
+    82u, 2u, 82u, 3u, 83u, 0u, 83u, 1u, 83u, 2u, 83u, 3u,
+    84u, 0u, 84u, 1u, 84u, 2u, 84u, 3u, 85u, 0u, 85u, 1u,
+    85u, 2u, 85u, 3u, 86u, 0u, 86u, 1u, 86u, 2u, 86u, 3u,
+    87u, 0u, 87u, 1u, 87u, 2u, 87u, 3u, 88u, 0u, 88u, 1u,
+    88u, 2u, 88u, 3u, 88u, 4u, 89u, 0u, 89u, 1u, 89u, 2u,
+    89u, 3u, 90u, 0u, 90u, 1u, 90u, 2u, 90u, 3u, 91u, 0u
+}};
+
+} 
+
+#endif
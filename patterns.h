@@ -1,6 +1,12 @@
+// Generated by pattern_codegen from patterns.tsv; edit patterns.tsv and re-run pattern_codegen instead.
 // These are the regex patterns with matching construction IDs
 // used as a starter set to initialize the patterns vector.
 // Some IDs are skipped because the constructions are too noisy or complex for now.
+// Each pattern has a parse method: FullAuto triggers (e.g. "because") are verified without a prompt,
+// SemiAuto triggers are shown for validation, and Manual triggers (e.g. "where", "so") are not searched.
+// Verbs are written as lemma macros, e.g. {cause}, which expand to all their forms (see lexicon.h).
+// Discontinuous constructions (e.g. "the aftermath of <cause> is") are gapped patterns: an anchor, the most
+// tokens allowed before the closing, and a closing, which has to follow the anchor in the same sentence.
 
 #ifndef PATTERNS_H
 #define PATTERNS_H
@@ -18,466 +24,558 @@ const std::initializer_list<CausalPattern> patterns = {
 
 {
     "<cause> where <effect>",
-    std::regex(R"(\bwhere\b)", std::regex::icase),
-    {"C001"}
+    R"(\bwhere\b)",
+    {"C001"},
+    ParseMethod::Manual
 },
 {
     "Having <cause>, <effect>",
-    std::regex(R"(\bHaving\s*,\b)", std::regex::icase),
-    {"C005"}
+    R"(\bHaving\s*,\b)",
+    {"C005"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect>, as <cause>",
-    std::regex(R"(\b,\s+as\b)", std::regex::icase),
-    {"C010"}
+    R"(\b,\s+as\b)",
+    {"C010"},
+    ParseMethod::Manual
 },
 {
     "<effect> arises from <cause>",
-    std::regex(R"(\b(arise|arises|arose|arisen|arising)\s+from\b)", std::regex::icase),
-    {"C011"}
+    R"(\b{arise}\s+from\b)",
+    {"C011"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> brings on <effect>",
-    std::regex(R"(\b(bring|brings|brought|bringing)\s+on\b)", std::regex::icase),
-    {"C012"}
+    R"(\b{bring}\s+on\b)",
+    {"C012"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> creates <effect>",
-    std::regex(R"(\b(create|creates|created|creating)\b)", std::regex::icase),
-    {"C013"}
+    R"(\b{create}\b)",
+    {"C013"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> produces <effect>",
-    std::regex(R"(\bproduces\b)", std::regex::icase),
-    {"C014"}
+    R"(\b{produce}\b)",
+    {"C014"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> engenders <effect>",
-    std::regex(R"(\b(engender|engenders|engendered|engendering)\b)", std::regex::icase),
-    {"C015"}
+    R"(\b{engender}\b)",
+    {"C015"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> generates <effect>",
-    std::regex(R"(\b(generate|generates|generated|generating)\b)", std::regex::icase),
-    {"C016"}
+    R"(\b{generate}\b)",
+    {"C016"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> gives rise to <effect>",
-    std::regex(R"(\b(give|gives|gave|given|giving)\s+rise\s+to\b)", std::regex::icase),
-    {"C017"}
+    R"(\b{give}\s+rise\s+to\b)",
+    {"C017"},
+    ParseMethod::FullAuto
 },
 {
     "<cause> incites <effect>",
-    std::regex(R"(\b(incite|incites|incited|inciting)\b)", std::regex::icase),
-    {"C018"}
+    R"(\b{incite}\b)",
+    {"C018"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> launches <effect>",
-    std::regex(R"(\b(launch|launches|launched|launching)\b)", std::regex::icase),
-    {"C019"}
+    R"(\b{launch}\b)",
+    {"C019"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> sets off <effect>",
-    std::regex(R"(\b(set|sets|setting)\s+off\b)", std::regex::icase),
-    {"C020"}
+    R"(\b{set}\s+off\b)",
+    {"C020"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect> stems from <cause>",
-    std::regex(R"(\b(stem|stems|stemmed|stemming)\s+from\b)", std::regex::icase),
-    {"C021"}
+    R"(\b{stem}\s+from\b)",
+    {"C021"},
+    ParseMethod::FullAuto
 },
 {
     "<cause> triggers <effect>",
-    std::regex(R"(\b(trigger|triggers|triggered|triggering)\b)", std::regex::icase),
-    {"C022"}
+    R"(\b{trigger}\b)",
+    {"C022"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> sparks <effect>",
-    std::regex(R"(\b(spark|sparks|sparked|sparking)\b)", std::regex::icase),
-    {"C023"}
+    R"(\b{spark}\b)",
+    {"C023"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> precipitates <effect>",
-    std::regex(R"(\b(precipitate|precipitates|precipitated|precipitating)\b)", std::regex::icase),
-    {"C024"}
+    R"(\b{precipitate}\b)",
+    {"C024"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> eliminates <effect>",
-    std::regex(R"(\b(eliminate|eliminates|eliminated|eliminating)\b)", std::regex::icase),
-    {"C025"}
+    R"(\b{eliminate}\b)",
+    {"C025"},
+    ParseMethod::SemiAuto
 },
 {
     "If <cause>, <effect>",
-    std::regex(R"(\bIf\s*,\b)", std::regex::icase),
-    {"C027"}
+    R"(\bIf\s*,\b)",
+    {"C027"},
+    ParseMethod::SemiAuto
 },
 {
     "should <cause>, <effect>",
-    std::regex(R"(\bshould\s*,\b)", std::regex::icase),
-    {"C028"}
+    R"(\bshould\s*,\b)",
+    {"C028"},
+    ParseMethod::SemiAuto
 },
 {
     "<Had cause>, <effect>",
-    std::regex(R"(\bHad\b)", std::regex::icase),
-    {"C029"}
+    R"(\bHad\b)",
+    {"C029"},
+    ParseMethod::Manual
 },
 {
     "<cause> allows <effect>",
-    std::regex(R"(\b(allow|allows|allowed|allowing)\b)", std::regex::icase),
-    {"C030"}
+    R"(\b{allow}\b)",
+    {"C030"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> compels <effect> to <effect>",
-    std::regex(R"(\b(compel|compels|compelled|compelling)\s+to\b)", std::regex::icase),
-    {"C031"}
+    R"(\b{compel}\s+to\b)",
+    {"C031"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> forces <effect>",
-    std::regex(R"(\b(force|forces|forced|forcing)\b)", std::regex::icase),
-    {"C032"}
+    R"(\b{force}\b)",
+    {"C032"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> lets <effect> <effect>",
-    std::regex(R"(\b(let|lets|letting|allowed)\b)", std::regex::icase),
-    {"C033"}
+    R"(\b{let}\b)",
+    {"C033"},
+    ParseMethod::Manual
 },
 {
     "<cause> makes <effect> <effect>",
-    std::regex(R"(\b(make|makes|made|making)\b)", std::regex::icase),
-    {"C034"}
+    R"(\b{make}\b)",
+    {"C034"},
+    ParseMethod::Manual
 },
 {
     "<cause> obliges <effect> to <effect>",
-    std::regex(R"(\b(oblige|obliges|obliged|obliging)\s+to\b)", std::regex::icase),
-    {"C035"}
+    R"(\b{oblige}\s+to\b)",
+    {"C035"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> permits <effect>",
-    std::regex(R"(\b(permit|permits|permitted|permitting)\b)", std::regex::icase),
-    {"C036"}
+    R"(\b{permit}\b)",
+    {"C036"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> requires <effect>",
-    std::regex(R"(\b(require|requires|required|requiring)\b)", std::regex::icase),
-    {"C037"}
+    R"(\b{require}\b)",
+    {"C037"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> forbids <effect>",
-    std::regex(R"(\b(forbid|forbids|forbade|forbidding)\b)", std::regex::icase),
-    {"C038"}
+    R"(\b{forbid}\b)",
+    {"C038"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> prevents <effect>",
-    std::regex(R"(\b(prevent|prevents|prevented|preventing)\b)", std::regex::icase),
-    {"C039"}
+    R"(\b{prevent}\b)",
+    {"C039"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> prohibits <effect>",
-    std::regex(R"(\b(prohibit|prohibits|prohibited|prohibiting)\b)", std::regex::icase),
-    {"C040"}
+    R"(\b{prohibit}\b)",
+    {"C040"},
+    ParseMethod::SemiAuto
 },
 {
     "Once <cause>, <effect>",
-    std::regex(R"(\bOnce\s*,\b)", std::regex::icase),
-    {"C047"}
+    R"(\bOnce\s*,\b)",
+    {"C047"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect>, since <cause>",
-    std::regex(R"(\b,\s+since\b)", std::regex::icase),
-    {"C051"}
+    R"(\b,\s+since\b)",
+    {"C051"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause>, and then <effect>",
-    std::regex(R"(\b,\s+and\s+then\b)", std::regex::icase),
-    {"C052"}
+    R"(\b,\s+and\s+then\b)",
+    {"C052"},
+    ParseMethod::SemiAuto
 },
 {
     "the aftermath of <cause> is <effect>",
-    std::regex(R"(\bthe\s+aftermath\s+of\s+.*?\s+is\b)", std::regex::icase),
-    {"C053"}
+    R"(\bthe\s+aftermath\s+of\b)", 10, R"(\bis\b)",
+    {"C053"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect> takes <cause>",
-    std::regex(R"(\btakes\b)", std::regex::icase),
-    {"C065"}
+    R"(\btakes\b)",
+    {"C065"},
+    ParseMethod::Manual
 },
 {
     "<effect> comes after <cause>",
-    std::regex(R"(\b(come|comes|coming)\s+after\b)", std::regex::icase),
-    {"C066"}
+    R"(\b{come}\s+after\b)",
+    {"C066"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect> follows <cause>",
-    std::regex(R"(\b(follow|follows|followed|following)\b)", std::regex::icase),
-    {"C067"}
+    R"(\b{follow}\b)",
+    {"C067"},
+    ParseMethod::Manual
 },
 {
     "<effect> is conditioned on <cause>",
-    std::regex(R"(\bis\s+conditioned\s+on\b)", std::regex::icase),
-    {"C070"}
+    R"(\bis\s+conditioned\s+on\b)",
+    {"C070"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect> is contingent on <cause>",
-    std::regex(R"(\bis\s+contingent\s+on\b)", std::regex::icase),
-    {"C071"}
+    R"(\bis\s+contingent\s+on\b)",
+    {"C071"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> is critical to <effect>",
-    std::regex(R"(\bis\s+critical\s+to\b)", std::regex::icase),
-    {"C072"}
+    R"(\bis\s+critical\s+to\b)",
+    {"C072"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> is essential to <effect>",
-    std::regex(R"(\bis\s+essential\s+to\b)", std::regex::icase),
-    {"C073"}
+    R"(\bis\s+essential\s+to\b)",
+    {"C073"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> is responsible for <effect>",
-    std::regex(R"(\bis\s+responsible\s+for\b)", std::regex::icase),
-    {"C074"}
+    R"(\bis\s+responsible\s+for\b)",
+    {"C074"},
+    ParseMethod::FullAuto
 },
 {
     "<cause> is vital to <effect>",
-    std::regex(R"(\bis\s+vital\s+to\b)", std::regex::icase),
-    {"C075"}
+    R"(\bis\s+vital\s+to\b)",
+    {"C075"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause>, and consequently, <effect>",
-    std::regex(R"(\b,\s+and\s+consequently,\b)", std::regex::icase),
-    {"C076"}
+    R"(\b,\s+and\s+consequently,\b)",
+    {"C076"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause>; hence, <effect>",
-    std::regex(R"(\b;\s+hence,\b)", std::regex::icase),
-    {"C077"}
+    R"(\b;\s+hence,\b)",
+    {"C077"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause>; therefore, <effect>",
-    std::regex(R"(\b;\s+therefore,\b)", std::regex::icase),
-    {"C078"}
+    R"(\b;\s+therefore,\b)",
+    {"C078"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> is why <effect>",
-    std::regex(R"(\bis\s+why\b)", std::regex::icase),
-    {"C079"}
+    R"(\bis\s+why\b)",
+    {"C079"},
+    ParseMethod::FullAuto
 },
 {
     "<cause>, so <effect>",
-    std::regex(R"(\b,\s+so\b)", std::regex::icase),
-    {"C099"}
+    R"(\b,\s+so\b)",
+    {"C099"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause>, and thus <effect>",
-    std::regex(R"(\b,\s+and\s+thus\b)", std::regex::icase),
-    {"C100"}
+    R"(\b,\s+and\s+thus\b)",
+    {"C100"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect> because <cause>",
-    std::regex(R"(\bbecause\b)", std::regex::icase),
-    {"C102"}
+    R"(\bbecause\b)",
+    {"C102"},
+    ParseMethod::FullAuto
 },
 {
     "Given <cause>, <effect>",
-    std::regex(R"(\bGiven\s*,\b)", std::regex::icase),
-    {"C104"}
+    R"(\bGiven\s*,\b)",
+    {"C104"},
+    ParseMethod::SemiAuto
 },
 {
     "In an attempt to <cause>, <effect>",
-    std::regex(R"(\bIn\s+an\s+attempt\s+to\s*,\b)", std::regex::icase),
-    {"C105"}
+    R"(\bIn\s+an\s+attempt\s+to\s*,\b)",
+    {"C105"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect> lest <cause>",
-    std::regex(R"(\blest\b)", std::regex::icase),
-    {"C106"}
+    R"(\blest\b)",
+    {"C106"},
+    ParseMethod::SemiAuto
 },
 {
     "Now that <cause>, <effect>",
-    std::regex(R"(\bNow\s+that\s*,\b)", std::regex::icase),
-    {"C107"}
+    R"(\bNow\s+that\s*,\b)",
+    {"C107"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect> so <cause>",
-    std::regex(R"(\bso\b)", std::regex::icase),
-    {"C108"}
+    R"(\bso\b)",
+    {"C108"},
+    ParseMethod::Manual
 },
 {
     "<effect> thanks to <cause>",
-    std::regex(R"(\bthanks\s+to\b)", std::regex::icase),
-    {"C109"}
+    R"(\bthanks\s+to\b)",
+    {"C109"},
+    ParseMethod::FullAuto
 },
 {
     "<cause> else <effect>",
-    std::regex(R"(\belse\b)", std::regex::icase),
-    {"C110"}
+    R"(\belse\b)",
+    {"C110"},
+    ParseMethod::Manual
 },
 {
     "<effect> unless <cause>",
-    std::regex(R"(\bunless\b)", std::regex::icase),
-    {"C111"}
+    R"(\bunless\b)",
+    {"C111"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> is DET cause of <effect>",
-    std::regex(R"(\bis\s+(the|a|an|this|that|these|those)\s+cause\s+of\b)", std::regex::icase),
-    {"C112"}
+    R"(\bis\s+(the|a|an|this|that|these|those)\s+cause\s+of\b)",
+    {"C112"},
+    ParseMethod::FullAuto
 },
 {
     "DET consequence of <cause> is <effect>",
-    std::regex(R"(\b(the|a|an|this|that|these|those)\s+consequence\s+of\s+.*?\s+is\b)", std::regex::icase),
-    {"C113"}
+    R"(\b(the|a|an|this|that|these|those)\s+consequence\s+of\b)", 10, R"(\bis\b)",
+    {"C113"},
+    ParseMethod::SemiAuto
 },
 {
     "DET effect of <cause> is <effect>",
-    std::regex(R"(\b(the|a|an|this|that|these|those)\s+effect\s+of\s+.*?\s+is\b)", std::regex::icase),
-    {"C114"}
+    R"(\b(the|a|an|this|that|these|those)\s+effect\s+of\b)", 10, R"(\bis\b)",
+    {"C114"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> is grounds for <effect>",
-    std::regex(R"(\bis\s+grounds\s+for\b)", std::regex::icase),
-    {"C115"}
+    R"(\bis\s+grounds\s+for\b)",
+    {"C115"},
+    ParseMethod::SemiAuto
 },
 {
     "the implications of <cause> are <effect>",
-    std::regex(R"(\bthe\s+implications\s+of\s+.*?\s+are\b)", std::regex::icase),
-    {"C116"}
+    R"(\bthe\s+implications\s+of\b)", 10, R"(\bare\b)",
+    {"C116"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> is the key to <effect>",
-    std::regex(R"(\bis\s+the\s+key\s+to\b)", std::regex::icase),
-    {"C117"}
+    R"(\bis\s+the\s+key\s+to\b)",
+    {"C117"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> is DET necessary condition of <effect>",
-    std::regex(R"(\bis\s+(the|a|an|this|that|these|those)\s+necessary\s+condition\s+of\b)", std::regex::icase),
-    {"C118"}
+    R"(\bis\s+(the|a|an|this|that|these|those)\s+necessary\s+condition\s+of\b)",
+    {"C118"},
+    ParseMethod::SemiAuto
 },
 {
     "DET reason [that] <effect> is <cause>",
-    std::regex(R"(\b(the|a|an|this|that|these|those)\s+reason\s+(that\s+)?\s*.*?\s+is\b)", std::regex::icase),
-    {"C119"}
+    R"(\b(the|a|an|this|that|these|those)\s+reason(\s+that)?\b)", 10, R"(\bis\b)",
+    {"C119"},
+    ParseMethod::SemiAuto
 },
 {
     "DET reason for <effect> is <cause>",
-    std::regex(R"(\b(the|a|an|this|that|these|those)\s+reason\s+for\s+.*?\s+is\b)", std::regex::icase),
-    {"C120"}
+    R"(\b(the|a|an|this|that|these|those)\s+reason\s+for\b)", 10, R"(\bis\b)",
+    {"C120"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> is reason to <effect>",
-    std::regex(R"(\bis\s+reason\s+to\b)", std::regex::icase),
-    {"C121"}
+    R"(\bis\s+reason\s+to\b)",
+    {"C121"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> is reason why <effect>",
-    std::regex(R"(\bis\s+reason\s+why\b)", std::regex::icase),
-    {"C122"}
+    R"(\bis\s+reason\s+why\b)",
+    {"C122"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect> is DET result of <cause>",
-    std::regex(R"(\bis\s+(the|a|an|this|that|these|those)\s+result\s+of\b)", std::regex::icase),
-    {"C123"}
+    R"(\bis\s+(the|a|an|this|that|these|those)\s+result\s+of\b)",
+    {"C123"},
+    ParseMethod::FullAuto
 },
 {
     "<cause> is condition of <effect>",
-    std::regex(R"(\bis\s+condition\s+of\b)", std::regex::icase),
-    {"C124"}
+    R"(\bis\s+condition\s+of\b)",
+    {"C124"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect> because of <cause>",
-    std::regex(R"(\bbecause\s+of\b)", std::regex::icase),
-    {"C125"}
+    R"(\bbecause\s+of\b)",
+    {"C125"},
+    ParseMethod::FullAuto
 },
 {
     "<effect> by reason of <cause>",
-    std::regex(R"(\bby\s+reason\s+of\b)", std::regex::icase),
-    {"C127"}
+    R"(\bby\s+reason\s+of\b)",
+    {"C127"},
+    ParseMethod::FullAuto
 },
 {
     "<effect> for the sake of <cause>",
-    std::regex(R"(\bfor\s+the\s+sake\s+of\b)", std::regex::icase),
-    {"C129"}
+    R"(\bfor\s+the\s+sake\s+of\b)",
+    {"C129"},
+    ParseMethod::SemiAuto
 },
 {
     "In light of <cause>, <effect>",
-    std::regex(R"(\bIn\s+light\s+of\s*,\b)", std::regex::icase),
-    {"C133"}
+    R"(\bIn\s+light\s+of\s*,\b)",
+    {"C133"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> ensures <effect>",
-    std::regex(R"(\bensures\b)", std::regex::icase),
-    {"C139"}
+    R"(\b{ensure}\b)",
+    {"C139"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> guarantees <effect>",
-    std::regex(R"(\bguarantees\b)", std::regex::icase),
-    {"C140"}
+    R"(\b{guarantee}\b)",
+    {"C140"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> makes certain <effect>",
-    std::regex(R"(\bmakes\s+certain\b)", std::regex::icase),
-    {"C141"}
+    R"(\b{make}\s+certain\b)",
+    {"C141"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> assures <effect>",
-    std::regex(R"(\b(assure|assures|assured|assuring)\b)", std::regex::icase),
-    {"C142"}
+    R"(\b{assure}\b)",
+    {"C142"},
+    ParseMethod::SemiAuto
 },
 {
     "NP attributes <effect> to <cause>",
-    std::regex(R"(\b(attribute|attributes|attributed|attributing)\s+to\b)", std::regex::icase),
-    {"C143"}
+    R"(\b{attribute}\s+to\b)",
+    {"C143"},
+    ParseMethod::SemiAuto
 },
 {
     "NP blames <cause> for <effect>",
-    std::regex(R"(\b(blame|blames|blamed|blaming)\s+for\b)", std::regex::icase),
-    {"C144"}
+    R"(\b{blame}\s+for\b)",
+    {"C144"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> brings <effect> to <effect>",
-    std::regex(R"(\b(bring|brings|brought|bringing)\s+to\b)", std::regex::icase),
-    {"C145"}
+    R"(\b{bring}\s+to\b)",
+    {"C145"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> causes <effect>",
-    std::regex(R"(\b(cause|causes|caused|causing)\b)", std::regex::icase),
-    {"C146"}
+    R"(\b{cause}\b)",
+    {"C146"},
+    ParseMethod::SemiAuto
 },
 {
     "<effect> comes from <cause>",
-    std::regex(R"(\b(come|comes|coming)\s+from\b)", std::regex::icase),
-    {"C147"}
+    R"(\b{come}\s+from\b)",
+    {"C147"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> contributes to <effect>",
-    std::regex(R"(\b(contribute|contributes|contributed|contributing)\s+to\b)", std::regex::icase),
-    {"C148"}
+    R"(\b{contribute}\s+to\b)",
+    {"C148"},
+    ParseMethod::FullAuto
 },
 {
     "<effect> depends on <cause>",
-    std::regex(R"(\b(depend|depends|depended|depending)\s+on\b)", std::regex::icase),
-    {"C149"}
+    R"(\b{depend}\s+on\b)",
+    {"C149"},
+    ParseMethod::SemiAuto
 },
 {
     "<cause> drives <effect>",
-    std::regex(R"(\b(drive|drives|driving)\b)", std::regex::icase),
-    {"C150"}
+    R"(\b{drive}\b)",
+    {"C150"},
+    ParseMethod::Manual
 },
 {
     "<cause> eases <effect>",
-    std::regex(R"(\b(ease|eases|eased|easing)\b)", std::regex::icase),
-    {"C151"}
+    R"(\b{ease}\b)",
+    {"C151"},
+    ParseMethod::Manual
 },
 {
     "<cause> enables <effect>",
-    std::regex(R"(\b(enable|enables|enabled|enabling)\b)", std::regex::icase),
-    {"C152"} 
+    R"(\b{enable}\b)",
+    {"C152"},
+    ParseMethod::SemiAuto
 },
 {
     "the probable cause of <effect> was <cause",
-    std::regex(R"(\bthe\s+probable\s+cause\s+of\b)", std::regex::icase),
-    {"M001"}
+    R"(\bthe\s+probable\s+cause\s+of\b)",
+    {"M001"},
+    ParseMethod::FullAuto
 },
 };
 
 } 
 
-#endif 
\ No newline at end of file
+#endif
\ No newline at end of file
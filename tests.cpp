@@ -1,9 +1,16 @@
 // This code for testing functions is AI-generated
 
 #include "constructicon-simple.h"
+#include "patterns.h"
+#include "pattern_tables.h"
 #include <iostream>
 #include <cstdlib>
+#include <cstdio>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
 #include <regex>
+#include <algorithm>
 
 namespace CC = CausalConstructicon;
 
@@ -38,8 +45,8 @@ int main() {
     }
     
     // Test Data
-    CausalConstruction test_c = {"T999", CausalDegree::Facilitate, CausalOrder::CE, "Test template", "Test example"};
-    CausalPattern test_p = {"Test pattern", std::regex("test pattern", std::regex::icase), {"T999"}};
+    CC::CausalConstruction test_c = {"T999", CausalDegree::Facilitate, CausalOrder::CE, "Test template", "Test example"};
+    CC::CausalPattern test_p = {"Test pattern", std::regex("test pattern", std::regex::icase), {"T999"}};
     
     size_t initial_c_size = CC::getConstructions().size();
     size_t initial_p_size = CC::getPatterns().size();
@@ -94,6 +101,630 @@ int main() {
         failures++;
     }
 
+    // Test 7: PatternMatcher (all hits in one pass, same offsets as std::regex)
+    std::cout << "Test 7: PatternMatcher (All Hits) ... ";
+    {
+        std::vector<CC::CausalPattern> matcher_patterns = {
+            {"<cause> causes <effect>", R"(\b(cause|causes|caused|causing)\b)", {"C146"}},
+            {"<effect> because of <cause>", R"(\bbecause\s+of\b)", {"C125"}}
+        };
+        CC::PatternMatcher matcher(matcher_patterns);
+        std::string text = "Ice caused the stall because of icing, which Caused the crash.";
+        auto hits = matcher.match(text);
+        if (matcher.compiledCount() == 2 && hits.size() == 3
+            && hits[0].patternIndex == 0 && text.substr(hits[0].start, hits[0].end - hits[0].start) == "caused"
+            && hits[1].patternIndex == 1 && text.substr(hits[1].start, hits[1].end - hits[1].start) == "because of"
+            && hits[2].patternIndex == 0 && text.substr(hits[2].start, hits[2].end - hits[2].start) == "Caused") {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Unexpected matches (" << hits.size() << " hits)." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 8: PatternMatcher required literals (prefilter)
+    std::cout << "Test 8: PatternMatcher (Required Literals) ... ";
+    {
+        std::vector<CC::CausalPattern> matcher_patterns = {
+            {"<cause> gives rise to <effect>", R"(\b(give|gives|gave|given|giving)\s+rise\s+to\b)", {"C017"}},
+            {"<cause> contributes to <effect>", R"(\b(contribute|contributes|contributed|contributing)\s+to\b)", {"C148"}}
+        };
+        CC::PatternMatcher matcher(matcher_patterns);
+        auto candidates = matcher.candidatePatterns("factors contributing to the accident");
+        if (matcher.requiredLiterals(0) == std::vector<std::string>{"rise"}
+            && matcher.requiredLiterals(1) == std::vector<std::string>{"contribut"}
+            && !candidates[0] && candidates[1]) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Unexpected required literals." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 9: PatternMatcher overlap resolution (longest match first)
+    std::cout << "Test 9: PatternMatcher (Overlap Resolution) ... ";
+    {
+        std::vector<CC::CausalPattern> matcher_patterns = {
+            {"<effect> because <cause>", R"(\bbecause\b)", {"C102"}},
+            {"<effect> because of <cause>", R"(\bbecause\s+of\b)", {"C125"}}
+        };
+        CC::PatternMatcher matcher(matcher_patterns);
+        auto resolved = matcher.resolveOverlaps(matcher.match("The engine failed because of icing."));
+        if (matcher.priority(1) > matcher.priority(0) && resolved.size() == 1 && resolved[0].patternIndex == 1) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Overlapping matches were not resolved to \"because of\"." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 10: binary corpus round trip (corrupt headers are rejected)
+    std::cout << "Test 10: Binary Corpus (Round Trip) ... ";
+    {
+        std::vector<Annotator::Record> written = {
+            {101, "The pilot's failure to maintain clearance."},
+            {102, ""},
+            {103, "Fuel exhaustion due to \"improper\" planning."}
+        };
+        std::string path = "test_corpus.bin";
+        Annotator::RecordStore store;
+        std::vector<Annotator::Record> read;
+        bool ok = Annotator::writeCorpus(path, written)
+            && Annotator::corpusRecordCount(path) == written.size()
+            && Annotator::loadRecordsFromCorpus(path, store, read)
+            && read.size() == written.size();
+        for (size_t i = 0; ok && i < read.size(); i++) {
+            ok = read[i].recordID == written[i].recordID && read[i].probableCause == written[i].probableCause;
+        }
+
+        // corrupt headers are rejected: a text size that wraps around, a misaligned column, sections out of order
+        auto corrupted = [&path, &written](size_t field, uint64_t value) {
+            Annotator::writeCorpus(path, written);
+            std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(static_cast<std::streamoff>(field));
+            file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            file.close();
+            Annotator::RecordStore corruptStore;
+            std::vector<Annotator::Record> corruptRead;
+            return !Annotator::loadRecordsFromCorpus(path, corruptStore, corruptRead) && corruptRead.empty();
+        };
+        ok = ok && corrupted(offsetof(Annotator::CorpusHeader, textSize), ~static_cast<uint64_t>(0) - 8)
+            && corrupted(offsetof(Annotator::CorpusHeader, idsOffset), sizeof(Annotator::CorpusHeader) + 2)
+            && corrupted(offsetof(Annotator::CorpusHeader, textOffsetsOffset), sizeof(Annotator::CorpusHeader));
+        if (ok) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Records read from the binary corpus differ from those written, or a corrupt header was accepted." << std::endl;
+            failures++;
+        }
+        std::remove(path.c_str());
+    }
+
+    // Test 11: annotation log and compaction (only new rows are appended, duplicates are removed)
+    std::cout << "Test 11: Annotation Log (Compaction) ... ";
+    {
+        std::string logPath = "test_annotations.log";
+        std::string csvPath = "test_annotations.csv";
+        std::ofstream csv(csvPath);
+        csv << "construction_id,record_id,trigger,cause,effect,status\n"
+            << "C001,1,\"due to\",\"icing\",\"the \"loss\" of power\",Verified\n";
+        csv.close();
+
+        Annotator::AnnotationLog log(logPath, 2);
+        Annotator::AnnotationEntry duplicate(std::string("C001"), 1, "due to", "icing", "the \"loss\" of power", AnnotationStatus::Verified);
+        Annotator::AnnotationEntry added(std::string("C002"), 2, "because", "fatigue, and glare", "the collision", AnnotationStatus::Verified);
+        log.append(duplicate);
+        bool ok = log.commit();
+        log.append(added);
+        ok = ok && log.commit() && log.rowCount() == 2;
+        long rows = Annotator::compactAnnotations(log, csvPath);
+
+        std::vector<std::vector<std::string>> parsed;
+        std::ifstream result(csvPath);
+        std::string content((std::istreambuf_iterator<char>(result)), std::istreambuf_iterator<char>());
+        Annotator::parseCSV(content, [&parsed](const std::vector<std::string_view>& fields) {
+            parsed.emplace_back(fields.begin(), fields.end());
+        });
+
+        if (ok && rows == 2 && parsed.size() == 3 && parsed[1][4] == "the \"loss\" of power" && parsed[2][3] == "fatigue, and glare") {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Compacted annotations are missing rows or contain duplicates." << std::endl;
+            failures++;
+        }
+        std::remove(logPath.c_str());
+        std::remove(csvPath.c_str());
+    }
+
+    // Test 12: persistence writer (annotations and progress written in the background)
+    std::cout << "Test 12: Persistence Writer (Group Commit) ... ";
+    {
+        std::string logPath = "test_writer.log";
+        std::string progressPath = "test_progress.txt";
+        size_t total = 3000;
+        bool flushed = false;
+        {
+            Annotator::AnnotationLog log(logPath);
+            Annotator::DecisionLog decisions("test_writer_decisions.bin");
+            Annotator::PersistenceWriter writer(log, decisions, progressPath, 64);
+            writer.start();
+            for (size_t i = 0; i < total; i++) {
+                writer.submitAnnotation(Annotator::AnnotationEntry(std::string("C001"), static_cast<int>(i), "due to", "icing", "the accident", AnnotationStatus::Verified));
+                writer.submitProgress(i + 1);
+            }
+            flushed = writer.flush() && writer.durableAnnotations() == total;
+            writer.stop();
+        }
+
+        size_t rows = 0;
+        std::ifstream logFile(logPath);
+        std::string line;
+        while (std::getline(logFile, line)) rows++;
+        size_t progress = 0;
+        std::ifstream progressFile(progressPath);
+        progressFile >> progress;
+
+        if (flushed && rows == total + 1 && progress == total) {
+            std::cout << "OK" << std::endl;
+        } else if (!flushed) {
+            std::cerr << "FAIL: Persistence writer flush did not make all annotations durable." << std::endl;
+            failures++;
+        } else {
+            std::cerr << "FAIL: Persistence writer lost annotations or progress." << std::endl;
+            failures++;
+        }
+        std::remove(logPath.c_str());
+        std::remove(progressPath.c_str());
+        std::remove("test_writer_decisions.bin");
+    }
+
+    // Test 13: reload saved annotations (statuses and construction IDs mapped back, duplicates and out of range record IDs skipped)
+    std::cout << "Test 13: loadAnnotations (Reload) ... ";
+    {
+        std::string csvPath = "test_reload.csv";
+        std::ofstream csv(csvPath);
+        csv << "construction_id,record_id,trigger,cause,effect,status\n"
+            << "C017,7,\"contributing to\",\"glare\",\"the \"\"runway\"\" excursion\",Verified\n"
+            << "C102,8,\"because\",\"fatigue, and glare\",\"the collision\",Rejected\n"
+            << "C102,99999999999999999999,\"because\",\"fatigue\",\"the collision\",Verified\n"
+            << "C102,-8,\"because\",\"fatigue\",\"the collision\",Verified\n";
+        csv.close();
+
+        Annotator::AnnotationStore loaded;
+        long first = Annotator::loadAnnotations(csvPath, loaded);
+        long again = Annotator::loadAnnotations(csvPath, loaded, true);
+
+        if (first == 2 && again == 0 && loaded.size() == 2
+            && loaded[0].constructionID == CC::ConstructionHandle("C017") && loaded[0].recordID == 7
+            && loaded[0].effectText() == "the \"runway\" excursion" && loaded[0].status == AnnotationStatus::Verified
+            && loaded[1].causeText() == "fatigue, and glare" && loaded[1].status == AnnotationStatus::Rejected) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Reloaded annotations differ from the saved rows." << std::endl;
+            failures++;
+        }
+        std::remove(csvPath.c_str());
+    }
+
+    // Test 14: annotation spans (offsets into the record, pooled text when it does not occur there; saved offsets
+    // reload a repeated text at its own occurrence, and a repeated text without offsets is pooled rather than guessed)
+    std::cout << "Test 14: AnnotationEntry (Spans) ... ";
+    if (Annotator::records.empty()) {
+        std::cout << "SKIPPED (no records loaded)" << std::endl;
+    } else {
+        const auto& record = Annotator::records[0];
+        std::string_view statement = record.probableCause;
+        std::string_view cause = statement.substr(0, 10);
+        std::string_view effect = statement.substr(5, 10);
+        Annotator::AnnotationEntry entry(std::string("C001"), record.recordID, "not in the record", cause, effect, AnnotationStatus::Verified);
+
+        // first record in which "the " occurs twice
+        size_t repeatedIndex = 0;
+        size_t second = std::string_view::npos;
+        for (; repeatedIndex < Annotator::records.size(); repeatedIndex++) {
+            std::string_view text = Annotator::records[repeatedIndex].probableCause;
+            size_t first = text.find("the ");
+            second = first == std::string_view::npos ? first : text.find("the ", first + 1);
+            if (second != std::string_view::npos) break;
+        }
+        int repeatedID = repeatedIndex < Annotator::records.size() ? Annotator::records[repeatedIndex].recordID : 0;
+        Annotator::AnnotationEntry repeated(std::string("C001"), repeatedID, "", "", "", AnnotationStatus::Verified);
+        repeated.trigger = Annotator::TextSpan(static_cast<uint32_t>(second), static_cast<uint32_t>(second + 3));
+
+        std::string csvPath = "test_spans.csv";
+        {
+            std::ofstream csv(csvPath);
+            csv << "construction_id,record_id,trigger,cause,effect,status\n" << Annotator::annotationRow(repeated)
+                << "C001," << repeatedID << ",\"the\",\"\",\"\",Verified\n";
+        }
+        Annotator::AnnotationStore loaded;
+        long count = Annotator::loadAnnotations(csvPath, loaded);
+        std::remove(csvPath.c_str());
+
+        if (entry.recordIndex == 0 && entry.trigger.pooled() && entry.triggerText() == "not in the record"
+            && !entry.cause.pooled() && entry.causeText() == cause && entry.effectText() == effect
+            && entry.cause.overlaps(entry.effect) && !entry.trigger.overlaps(entry.cause)
+            && count == 2 && loaded[0].trigger.start == second && loaded[0].trigger.end == second + 3
+            && loaded[1].trigger.pooled() && loaded[1].triggerText() == "the") {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Annotation spans do not resolve to the record text, or did not reload at their saved offsets." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 15: columnar annotation store (indexes and column scans)
+    std::cout << "Test 15: AnnotationStore (Queries) ... ";
+    {
+        Annotator::AnnotationStore store;
+        auto add = [&store](const char* id, int recordID, AnnotationStatus status, uint32_t pattern) {
+            Annotator::AnnotationEntry entry(std::string(id), recordID, "due to", "icing", "the accident", status);
+            entry.patternIndex = pattern;
+            store.add(entry);
+        };
+        add("C148", 1, AnnotationStatus::Verified, 0);
+        add("C148", 2, AnnotationStatus::Rejected, 0);
+        add("C017", 2, AnnotationStatus::Verified, 1);
+        add("C148", 3, AnnotationStatus::Verified, 0);
+        add("TK", 3, AnnotationStatus::Verified, Annotator::NoPattern);
+        add("C017", 4, AnnotationStatus::Candidate, 1);
+
+        auto verified = store.select("C148", AnnotationStatus::Verified);
+        auto decisions = store.decisionsPerPattern(2);
+        if (store.size() == 6 && verified.size() == 2 && verified[0] == 0 && verified[1] == 3
+            && store.byRecord(2).size() == 2 && store.byRecord(9).empty() && store.byConstruction("C017").size() == 2
+            && store.count(AnnotationStatus::Rejected) == 1
+            && decisions[0].verified == 2 && decisions[0].rejected == 1 && decisions[1].rejectionRate() == 0.0
+            && decisions[1].candidates == 1 && decisions[0].candidates == 0
+            && store[2].constructionID == CC::ConstructionHandle("C017") && store[2].recordID == 2) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Annotation store queries returned the wrong rows." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 16: decision log (per-pattern counts read back; a partial record at the end is ignored; FullAuto hits are not decisions)
+    std::cout << "Test 16: DecisionLog (Pattern Precision) ... ";
+    {
+        std::string path = "test_decisions.bin";
+        std::vector<CC::CausalPattern> decision_patterns = {
+            {"<effect> because <cause>", R"(\bbecause\b)", {"C102"}},
+            {"<effect> due to <cause>", R"(\bdue\s+to\b)", {"C001"}}
+        };
+        auto decide = [&decision_patterns](size_t pattern, AnnotationStatus status, ParseMethod method = ParseMethod::SemiAuto) {
+            Annotator::DecisionRecord decision = {};
+            decision.recordID = 1;
+            decision.patternKey = Annotator::patternKey(decision_patterns[pattern]);
+            decision.status = static_cast<uint8_t>(status);
+            decision.method = static_cast<uint8_t>(method);
+            return decision;
+        };
+        {
+            Annotator::DecisionLog log(path);
+            log.append(decide(0, AnnotationStatus::Verified));
+            log.append(decide(0, AnnotationStatus::Verified));
+            log.append(decide(0, AnnotationStatus::Rejected));
+            log.append(decide(1, AnnotationStatus::Rejected));
+            log.append(decide(1, AnnotationStatus::Candidate));
+            // auto-verified matches of a pattern that was FullAuto at the time are not decisions
+            log.append(decide(1, AnnotationStatus::Verified, ParseMethod::FullAuto));
+            log.append(decide(1, AnnotationStatus::Verified, ParseMethod::FullAuto));
+            log.sync();
+        }
+        std::ofstream partial(path, std::ios::app | std::ios::binary);
+        partial << "xyz";
+        partial.close();
+        {
+            // appending after a crash drops the partial record first
+            Annotator::DecisionLog log(path);
+            log.append(decide(1, AnnotationStatus::Verified));
+        }
+
+        std::vector<Annotator::AnnotationStore::PatternDecisions> counts;
+        long read = Annotator::loadDecisions(path, decision_patterns, counts);
+        if (read == 8 && counts[0].verified == 2 && counts[0].rejected == 1 && counts[1].precision() == 0.5
+            && counts[1].candidates == 1 && counts[1].autoVerified == 2 && counts[0].autoVerified == 0
+            && counts[0].precision() > 0.66 && counts[0].precision() < 0.67) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Decision counts read back from the log are wrong." << std::endl;
+            failures++;
+        }
+        std::remove(path.c_str());
+    }
+
+    // Test 17: parse methods (Manual patterns are not searched; heuristic spans of auto-verified triggers)
+    std::cout << "Test 17: ParseMethod (Manual Skipped, Heuristic Spans) ... ";
+    {
+        std::vector<CC::CausalPattern> method_patterns = {
+            {"<cause> where <effect>", R"(\bwhere\b)", {"C001"}, ParseMethod::Manual},
+            {"<cause> contributes to <effect>", R"(\bcontributing\s+to\b)", {"C148"}, ParseMethod::FullAuto}
+        };
+        CC::PatternMatcher matcher(method_patterns);
+        std::string text = "The pilot landed where the runway was wet. Contributing to the accident was the pilot's fatigue.";
+        auto hits = matcher.match(text);
+
+        Annotator::TextSpan cause;
+        Annotator::TextSpan effect;
+        bool found = hits.size() == 1 && hits[0].patternIndex == 1 && !matcher.searched(0);
+        if (found) {
+            Annotator::heuristicSpans(method_patterns[1].description, text, hits[0].start, hits[0].end, cause, effect);
+        }
+        if (found && text.substr(cause.start, cause.end - cause.start) == "the pilot's fatigue"
+            && text.substr(effect.start, effect.end - effect.start) == "the accident") {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Manual pattern was searched or heuristic spans are wrong." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 18: record prefetcher (prepared records match a synchronous scan, skipped records are dropped)
+    std::cout << "Test 18: Record Prefetcher ... ";
+    {
+        const auto& records = Annotator::records;
+        const auto& matcher = CC::getMatcher();
+        Annotator::RecordPrefetcher prefetcher(2);
+        prefetcher.start(0);
+
+        bool same = true;
+        for (size_t i : {size_t(0), size_t(1), size_t(4), size_t(5)}) {
+            if (i >= records.size()) break;
+            auto prepared = prefetcher.take(i);
+            auto expected = matcher.resolveOverlaps(matcher.match(records[i].probableCause));
+            same = same && prepared.recordIndex == i && prepared.hits.size() == expected.size()
+                && prepared.highlights.size() == expected.size();
+            for (size_t h = 0; same && h < expected.size(); h++) {
+                same = prepared.hits[h].patternIndex == expected[h].patternIndex
+                    && prepared.hits[h].start == expected[h].start && prepared.hits[h].end == expected[h].end;
+            }
+        }
+        prefetcher.stop();
+
+        if (same && !prefetcher.running()) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Prefetched matches differ from a synchronous scan." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 19: pattern profile (same matches as an unprofiled scan; evaluations, bytes, and hits per pattern)
+    std::cout << "Test 19: Pattern Profile ... ";
+    {
+        std::vector<CC::CausalPattern> profile_patterns = {
+            {"<effect> because <cause>", R"(\bbecause\b)", {"C102"}},
+            {"<cause> causes <effect>", R"(\bcause[sd]?\b)", {"C146"}},
+            {"<cause> contributes to <effect>", R"(\bcontribut(e|es|ed|ing)\s+to\b)", {"C148"}}
+        };
+        CC::PatternMatcher matcher(profile_patterns);
+        CC::PatternProfile profile(profile_patterns.size());
+        std::string text = "The engine failed because fuel exhaustion caused a loss of power, because of poor planning.";
+
+        auto plain = matcher.match(text);
+        auto profiled = matcher.match(text, &profile);
+        bool same = plain.size() == profiled.size();
+        for (size_t i = 0; same && i < plain.size(); i++) {
+            same = plain[i].patternIndex == profiled[i].patternIndex && plain[i].start == profiled[i].start && plain[i].end == profiled[i].end;
+        }
+        profile.addDecisions(0, 1, 1);
+
+        auto because = profile[0];
+        auto contributes = profile[2];
+        auto report = profile.toJSON(profile_patterns);
+        if (same && because.evaluations == 1 && because.bytes == text.size() && because.hits == 2 && profile[1].hits == 1
+            && contributes.evaluations == 0 && report.size() == 2 && report[0].contains("rejection_rate")) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Pattern profile counters or matches are wrong." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 20: gapped patterns (anchor, at most maxGap tokens in the same sentence, closing)
+    std::cout << "Test 20: Gapped Patterns ... ";
+    {
+        std::vector<CC::CausalPattern> gapped_patterns = {
+            {"DET reason for <effect> is <cause>", R"(\b(the|a|an|this|that|these|those)\s+reason\s+for\b)", 4, R"(\bis\b)", {"C120"}}
+        };
+        CC::PatternMatcher matcher(gapped_patterns);
+        auto trigger = [&](const std::string& text) {
+            auto hits = matcher.match(text);
+            return hits.size() == 1 ? text.substr(hits[0].start, hits[0].end - hits[0].start) : std::string();
+        };
+
+        // a long text without a closing is scanned once, not once per anchor
+        std::string repeated;
+        for (int i = 0; i < 2000; i++) repeated += "the reason for the delay ";
+
+        if (matcher.compiledCount() == 1
+            && trigger("The reason for the power loss is fuel exhaustion.") == "The reason for the power loss is"
+            && trigger("The reason for the power loss. It is unknown.").empty()
+            && trigger("The reason for the total loss of engine power is unknown.").empty()
+            && matcher.match(repeated).empty()
+            && std::regex_search("The reason for the power loss is fuel exhaustion.", gapped_patterns[0].regex())) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Gapped pattern matched across a sentence, beyond its gap, or not at all." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 21: segmentation (tokens without punctuation, sentences, clauses at semicolons; index of all records)
+    std::cout << "Test 21: Segmentation ... ";
+    {
+        std::string text = "The pilot's failure (to refuel) caused 3.5 hours of delay; the crew - tired - erred. Fatigue: contributing";
+        CC::TextSegments segments;
+        CC::segmentText(text, segments);
+        CC::SegmentView view(segments);
+        auto piece = [&text](const CC::Segment& segment) { return text.substr(segment.start, segment.end - segment.start); };
+
+        size_t semicolon = text.find(';');
+        bool tokens = segments.tokens.size() == 16 && piece(segments.tokens[0]) == "The" && piece(segments.tokens[1]) == "pilot's"
+            && piece(segments.tokens[3]) == "to" && piece(segments.tokens[4]) == "refuel" && piece(segments.tokens[6]) == "3.5"
+            && view.tokensBetween(0, semicolon) == 10;
+        bool sentences = segments.sentences.size() == 2 && piece(segments.sentences[1]) == "Fatigue: contributing"
+            && view.sentenceAt(text.find("Fatigue")) == 1 && view.sentenceAt(semicolon) == 0;
+        bool clauses = segments.clauses.size() == 3 && piece(segments.clauses[0]) == text.substr(0, semicolon)
+            && piece(segments.clauses[1]) == "the crew - tired - erred." && view.clauseAt(semicolon + 2) == 1;
+        bool indexed = Annotator::segmentIndex.size() == Annotator::records.size();
+
+        if (tokens && sentences && clauses && indexed) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Segments of the text or the record index are wrong." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 22: word-sequence patterns (matched in the word trie, independent of case and whitespace, leftmost-first)
+    std::cout << "Test 22: Word Trie ... ";
+    {
+        std::vector<CC::CausalPattern> word_patterns = {
+            {"<cause> gives rise to <effect>", R"(\b(give|gives|gave|given|giving)\s+rise\s+to\b)", {"C054"}},
+            {"DET reason [that] <effect> is <cause>", R"(\bthe\s+reason(\s+that)?\b)", {"C119"}},
+            {"Having <cause>, <effect>", R"(\bHaving\s*,\b)", {"C005"}}
+        };
+        CC::PatternMatcher matcher(word_patterns);
+        std::string text = "Icing GAVE  rise\tto drag, which gives, rise to nothing. The reason that it stalled";
+        auto hits = matcher.match(text);
+        auto trigger = [&text](const CC::PatternMatch& hit) { return text.substr(hit.start, hit.end - hit.start); };
+
+        if (matcher.wordPattern(0) && matcher.wordPattern(1) && !matcher.wordPattern(2) && hits.size() == 2
+            && trigger(hits[0]) == "GAVE  rise\tto" && trigger(hits[1]) == "The reason that"
+            && CC::tokenDictionary.find("rise") != CC::TokenDictionary::NoToken) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Word-sequence patterns were not matched like their regexes." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 23: lemma macros (regular spelling rules, irregular forms from the lexicon, expansion in sources)
+    std::cout << "Test 23: Lemma Lexicon ... ";
+    {
+        auto forms = [](std::string_view lemma) {
+            std::string joined;
+            for (const auto& form : CC::inflect(lemma)) joined += (joined.empty() ? "" : "|") + form;
+            return joined;
+        };
+        CC::CausalPattern lemma_pattern("<cause> produces <effect>", R"(\b{produce}\b)", {"C014"});
+
+        if (forms("produce") == "produce|produces|produced|producing" && forms("carry") == "carry|carries|carried|carrying"
+            && forms("launch") == "launch|launches|launched|launching" && forms("give") == "give|gives|gave|given|giving"
+            && forms("let") == "let|lets|letting" && forms("guarantee") == "guarantee|guarantees|guaranteed|guaranteeing"
+            && lemma_pattern.source == R"(\b(produce|produces|produced|producing)\b)"
+            && std::regex_search("The fire produced smoke", lemma_pattern.regex())
+            && CC::expandLemmas(R"(a{2}\{x})") == R"(a{2}\{x})") {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Lemma macros were not expanded to the right forms." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 24: generated matcher tables (current for the initial patterns, loading gives the compiled matcher)
+    std::cout << "Test 24: Generated Matcher Tables ... ";
+    {
+        std::vector<CC::CausalPattern> initial(InitialPatterns::patterns);
+        uint64_t hash = CC::patternSetHash(initial);
+        CC::PatternMatcher compiled(initial);
+        CC::PatternMatcher::Image image = compiled.image(hash);
+        CC::PatternMatcher loaded(initial, image);
+        CC::PatternMatcher::Image truncated = image;
+        truncated.trieEdges.pop_back();
+
+        std::vector<CC::CausalPattern> extended = initial;
+        extended.emplace_back("<effect> owing to <cause>", R"(\bowing\s+to\b)", std::vector<CC::ConstructionHandle>{"C125"});
+
+        std::string text = "The engine failed because of fuel exhaustion, which led to a forced landing; "
+            "the pilot's failure to maintain airspeed resulted in a stall.";
+        auto expected = compiled.match(text);
+        auto actual = loaded.match(text);
+        bool same = !expected.empty() && expected.size() == actual.size();
+        for (size_t i = 0; same && i < expected.size(); i++) {
+            same = expected[i].patternIndex == actual[i].patternIndex && expected[i].start == actual[i].start
+                && expected[i].end == actual[i].end;
+        }
+        for (size_t i = 0; same && i < initial.size(); i++) {
+            same = compiled.priority(i) == loaded.priority(i) && compiled.requiredLiterals(i) == loaded.requiredLiterals(i);
+        }
+        // edges are written in word order, so the image does not depend on the order words were interned in
+        for (size_t node = 0; same && node < image.trie.size() / 4; node++) {
+            same = std::is_sorted(image.trieWords.begin() + image.trie[4 * node], image.trieWords.begin() + image.trie[4 * node + 1]);
+        }
+
+        if (hash == GeneratedMatcher::patternSetHash && same && image.consistent(initial.size())
+            && !truncated.consistent(initial.size()) && !image.consistent(initial.size() + 1)
+            && CC::patternSetHash(extended) != hash) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Generated tables are stale (re-run pattern_codegen) or do not load to the compiled matcher." << std::endl;
+            failures++;
+        }
+    }
+
+    // Test 25: matcher cache (round trip of an image, rejected for another pattern set or when truncated;
+    // getMatcher only writes one to a path that was set)
+    std::cout << "Test 25: Matcher Cache ... ";
+    {
+        std::vector<CC::CausalPattern> cached_patterns(InitialPatterns::patterns);
+        cached_patterns.emplace_back("<effect> owing to <cause>", R"(\bowing\s+to\b)", std::vector<CC::ConstructionHandle>{"C125"});
+        uint64_t hash = CC::patternSetHash(cached_patterns);
+        CC::PatternMatcher::Image image = CC::PatternMatcher(cached_patterns).image(hash);
+
+        const std::string cache_file = "test_matcher.bin";
+        CC::PatternMatcher::Image read_back;
+        CC::PatternMatcher::Image other;
+        CC::PatternMatcher::Image truncated;
+        bool written = CC::writeMatcherCache(cache_file, image, cached_patterns.size());
+        bool read = CC::readMatcherCache(cache_file, hash, cached_patterns.size(), read_back);
+        bool other_set = CC::readMatcherCache(cache_file, hash + 1, cached_patterns.size(), other);
+        {
+            std::ifstream in(cache_file, std::ios::binary);
+            std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            std::ofstream out(cache_file, std::ios::binary | std::ios::trunc);
+            out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() / 2));
+        }
+        bool truncated_read = CC::readMatcherCache(cache_file, hash, cached_patterns.size(), truncated);
+        std::remove(cache_file.c_str());
+
+        // getMatcher only writes a cache once a path is set (the runtime patterns miss the generated tables),
+        // and never for a set with a pattern built from a compiled regex only (Test 6), whose regex is not hashed
+        std::ifstream existing("pattern_matcher.bin");
+        bool had_default = existing.is_open();
+        existing.close();
+        CC::addPattern(CC::CausalPattern("<effect> cache test one <cause>", R"(\bcache\s+test\s+one\b)", {"C125"}));
+        CC::getMatcher();
+        std::ifstream default_cache("pattern_matcher.bin");
+        bool wrote_default = !had_default && default_cache.is_open();
+        default_cache.close();
+        CC::setMatcherCachePath(cache_file);
+        CC::addPattern(CC::CausalPattern("<effect> cache test two <cause>", R"(\bcache\s+test\s+two\b)", {"C125"}));
+        CC::getMatcher();
+        CC::setMatcherCachePath("");
+        std::ifstream set_cache(cache_file);
+        bool wrote_unhashable = set_cache.is_open();
+        set_cache.close();
+        std::remove(cache_file.c_str());
+
+        bool same = read_back.patternSetHash == image.patternSetHash && read_back.program == image.program
+            && read_back.patterns == image.patterns && read_back.firstBytes == image.firstBytes
+            && read_back.literals == image.literals && read_back.literalOffsets == image.literalOffsets
+            && read_back.literalIndices == image.literalIndices && read_back.trie == image.trie
+            && read_back.trieEdges == image.trieEdges && read_back.trieWords == image.trieWords
+            && read_back.trieTerminals == image.trieTerminals;
+
+        if (written && read && same && read_back.consistent(cached_patterns.size()) && !other_set && !truncated_read
+            && !wrote_default && !wrote_unhashable) {
+            std::cout << "OK" << std::endl;
+        } else {
+            std::cerr << "FAIL: Matcher cache did not round-trip, a cache of another pattern set was read, or getMatcher wrote a cache it should not have." << std::endl;
+            failures++;
+        }
+    }
+
     std::cout << "\n--- Test Summary ---\n" << std::endl;
     if (failures == 0) {
         std::cout << "✅ All tests passed." << std::endl;